@@ -0,0 +1,173 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "BuildFingerprints.h"
+#include "ProjectGraph.h"
+
+static const uint64_t FnvOffsetBasis=14695981039346656037ULL;
+static const uint64_t FnvPrime=1099511628211ULL;
+
+const vector<wstring> BuildFingerprints::generatedFiles(const Options &options,const Project &project)
+{
+  vector<wstring>
+    fileNames;
+
+  if (!startsWith(project.directory(),L"ImageMagick\\"))
+    return(fileNames);
+
+  // The headers that Configure generates are included by every Magick project.
+  const auto directory=options.rootDirectory + L"ImageMagick\\" + options.magickCoreName() + L"\\";
+  const auto variantDirectory=project.variant().empty() ? directory : options.rootDirectory + options.variantOptions(project.variant()).variantDirectory() + L"\\" + options.magickCoreName() + L"\\";
+  fileNames.push_back(variantDirectory + L"magick-baseconfig.h");
+  fileNames.push_back(variantDirectory + L"version.h");
+  fileNames.push_back(directory + L"threshold-map.h");
+  fileNames.push_back(options.rootDirectory + L"Artifacts\\generated\\coders\\coders-list.h");
+  fileNames.push_back(options.rootDirectory + L"Artifacts\\generated\\coders\\coders-table.h");
+
+  return(fileNames);
+}
+
+uint64_t BuildFingerprints::hash(const uint64_t seed,const wstring &value)
+{
+  uint64_t
+    result;
+
+  result=seed;
+  for (const auto& c : value)
+  {
+    result=(result ^ (uint64_t) (c & 0xff)) * FnvPrime;
+    result=(result ^ (uint64_t) ((c >> 8) & 0xff)) * FnvPrime;
+  }
+
+  return(result);
+}
+
+optional<uint64_t> BuildFingerprints::hashFile(const wstring &fileName)
+{
+  char
+    buffer[65536];
+
+  uint64_t
+    result;
+
+  // This runs in a parallel algorithm where an exception would terminate the application, the caller reports the error.
+  ifstream file(fileName,ios::binary);
+  if (!file)
+    return(nullopt);
+
+  result=FnvOffsetBasis;
+  while (file.read(buffer,sizeof(buffer)) || file.gcount() > 0)
+  {
+    const auto count=(size_t) file.gcount();
+    for (size_t i=0; i < count; i++)
+      result=(result ^ (uint64_t) (unsigned char) buffer[i]) * FnvPrime;
+  }
+
+  return(result);
+}
+
+const wstring BuildFingerprints::optionsSummary(const Options &options)
+{
+  wstringstream
+    summary;
+
+  summary << options.abi() << L";" << options.instructionSetName() << L";" << (int) options.quantumDepth << L";";
+  summary << options.useHDRI << options.useOpenCL << options.useOpenMP << options.enableDpc << options.excludeDeprecated;
+  summary << options.installedSupport << options.zeroConfigurationSupport << options.cacheable << options.ltcg;
+  summary << options.ltcgDependencies << options.ltcgIncremental << options.pgo << (int) options.policyConfig;
+  summary << options.developerLink << options.delayLoad << options.isStaticBuild << options.linkRuntime;
+  summary << options.lazyCoders << options.magickAliases << (int) options.toolset << (int) options.visualStudioVersion;
+  summary << L";" << (int) options.instructionSet << L";" << options.variant;
+  for (const auto& variant : options.variants)
+    summary << L";" << variant;
+
+  return(summary.str());
+}
+
+void BuildFingerprints::write(const Options &options,const vector<Project> &projects)
+{
+  if (options.fingerprintsFile.empty())
+    return;
+
+  vector<wstring>
+    fileNames;
+
+  // Every file is hashed once, the vcxproj covers the defines, include directories and compiler settings.
+  for (const auto& project : projects)
+  {
+    fileNames.push_back(options.rootDirectory + project.fileName());
+    for (const auto& file : project.files())
+      fileNames.push_back(options.rootDirectory + project.directory() + file);
+    for (const auto& fileName : generatedFiles(options,project))
+    {
+      if (filesystem::exists(fileName))
+        fileNames.push_back(fileName);
+    }
+  }
+  sort(fileNames.begin(),fileNames.end());
+  fileNames.erase(unique(fileNames.begin(),fileNames.end()),fileNames.end());
+
+  vector<optional<uint64_t>> fileHashes(fileNames.size());
+  transform(execution::par,fileNames.begin(),fileNames.end(),fileHashes.begin(),[](const wstring &fileName) { return(hashFile(fileName)); });
+
+  map<wstring,uint64_t> hashes;
+  for (size_t i=0; i < fileNames.size(); i++)
+  {
+    if (!fileHashes[i])
+      throwException(L"Unable to open: " + fileNames[i]);
+
+    hashes[fileNames[i]]=*fileHashes[i];
+  }
+
+  const ProjectGraph graph(projects);
+  const auto summary=optionsSummary(options);
+  vector<optional<uint64_t>> fingerprints(projects.size());
+
+  // The graph has no cycles, the fingerprints of the references are computed first.
+  function<uint64_t(size_t)> fingerprint=[&](size_t index)
+  {
+    if (fingerprints[index])
+      return(*fingerprints[index]);
+
+    const auto& project=projects[index];
+    auto result=hash(FnvOffsetBasis,summary);
+    result=hash(result,project.defines());
+    result=hash(result,project.includeDirectories());
+    result=hash(result,project.fileName() + L"=" + to_wstring(hashes[options.rootDirectory + project.fileName()]));
+    for (const auto& file : project.files())
+      result=hash(result,file + L"=" + to_wstring(hashes[options.rootDirectory + project.directory() + file]));
+    for (const auto& fileName : generatedFiles(options,project))
+    {
+      const auto fileHash=hashes.find(fileName);
+      result=hash(result,fileName.substr(options.rootDirectory.length()) + L"=" + (fileHash == hashes.end() ? L"missing" : to_wstring(fileHash->second)));
+    }
+    for (const auto& dependency : graph.dependencies(index))
+      result=hash(result,projects[dependency].fullName() + L"=" + to_wstring(fingerprint(dependency)));
+
+    fingerprints[index]=result;
+    return(result);
+  };
+
+  wofstream file(options.fingerprintsFile);
+  if (!file)
+    throwException(L"Failed to open file: " + options.fingerprintsFile);
+
+  for (size_t i=0; i < projects.size(); i++)
+    file << projects[i].fullName() << " " << hex << setw(16) << setfill(L'0') << fingerprint(i) << dec << endl;
+}
@@ -0,0 +1,155 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "BuildGraph.h"
+#include "ProjectGraph.h"
+#include "Solution.h"
+
+const wstring BuildGraph::edgeType(const Project &project,const Project &reference)
+{
+  if (reference.isLibrary() && project.references().count(reference.name()) > 0)
+    return(L"reference");
+
+  if (reference.type() == ProjectType::Coder && project.coderReferences().count(reference.name()) > 0)
+    return(L"coderReference");
+
+  return(L"implicit");
+}
+
+const vector<double> BuildGraph::estimateCosts(const Options &options,const vector<Project> &projects)
+{
+  vector<double>
+    costs;
+
+  for (const auto& project : projects)
+  {
+    double cost=0.0;
+    for (const auto& file : project.files())
+    {
+      if (!endsWith(file,L".h"))
+        cost+=(double) filesystem::file_size(options.rootDirectory + project.directory() + file);
+    }
+    costs.push_back(cost);
+  }
+
+  return(costs);
+}
+
+const wstring BuildGraph::escape(const wstring &value)
+{
+  wstring
+    result;
+
+  for (const auto& c : value)
+  {
+    if (c == L'\\' || c == L'"')
+      result+=L'\\';
+    result+=c;
+  }
+
+  return(result);
+}
+
+void BuildGraph::write(const Options &options,const vector<Project> &projects,const optional<BuildTimings> &timings)
+{
+  if (options.graphFile.empty())
+    return;
+
+  wofstream file(options.graphFile);
+  if (!file)
+    throwException(L"Failed to open file: " + options.graphFile);
+
+  const ProjectGraph graph(projects);
+  const auto costs=timings ? timings->costs(projects) : estimateCosts(options,projects);
+  const auto finishTimes=graph.finishTimes(costs);
+  const auto criticalPath=graph.criticalPath(costs);
+
+  file << fixed << setprecision(0);
+  file << "{" << endl;
+  file << "  \"solution\": \"" << escape(Solution::solutionName(options)) << "\"," << endl;
+  file << "  \"platform\": \"" << options.platform() << "\"," << endl;
+  file << "  \"costUnit\": \"" << (timings ? "ms" : "bytes") << "\"," << endl;
+  file << "  \"criticalPath\": {" << endl;
+  file << "    \"cost\": " << (criticalPath.empty() ? 0.0 : finishTimes[criticalPath.back()]) << "," << endl;
+  file << "    \"projects\": [";
+  for (size_t i=0; i < criticalPath.size(); i++)
+    file << (i == 0 ? "" : ", ") << "\"" << escape(projects[criticalPath[i]].fullName()) << "\"";
+  file << "]" << endl;
+  file << "  }," << endl;
+  file << "  \"projects\": [" << endl;
+  for (size_t i=0; i < projects.size(); i++)
+  {
+    writeNode(file,options,projects,i,costs,finishTimes);
+    file << (i + 1 < projects.size() ? "," : "") << endl;
+  }
+  file << "  ]" << endl;
+  file << "}" << endl;
+}
+
+void BuildGraph::writeList(wofstream &file,const wstring &name,const wstring &values)
+{
+  file << "      \"" << name << "\": [";
+  bool first=true;
+  wstringstream stream(values);
+  wstring value;
+  while (getline(stream,value,L';'))
+  {
+    if (value.empty() || startsWith(value,L"%("))
+      continue;
+
+    file << (first ? "" : ", ") << "\"" << escape(value) << "\"";
+    first=false;
+  }
+  file << "]," << endl;
+}
+
+void BuildGraph::writeNode(wofstream &file,const Options &options,const vector<Project> &projects,const size_t index,const vector<double> &costs,const vector<double> &finishTimes)
+{
+  const auto& project=projects[index];
+
+  file << "    {" << endl;
+  file << "      \"name\": \"" << escape(project.fullName()) << "\"," << endl;
+  file << "      \"project\": \"" << escape(project.fileName()) << "\"," << endl;
+  file << "      \"type\": \"" << project.configurationType() << "\"," << endl;
+  file << "      \"output\": { \"debug\": \"" << escape(project.outputFileName(true)) << "\", \"release\": \"" << escape(project.outputFileName(false)) << "\" }," << endl;
+  file << "      \"sources\": [";
+  bool first=true;
+  for (const auto& fileName : project.files())
+  {
+    const auto sourceFile=project.directory() + fileName;
+    file << (first ? "" : ",") << endl;
+    file << "        { \"file\": \"" << escape(sourceFile) << "\", \"size\": " << filesystem::file_size(options.rootDirectory + sourceFile) << " }";
+    first=false;
+  }
+  file << (first ? "" : "\n      ") << "]," << endl;
+  writeList(file,L"defines",project.defines());
+  writeList(file,L"includeDirectories",replace(project.includeDirectories(),L"$(SolutionDir)",L""));
+  file << "      \"dependencies\": [";
+  first=true;
+  for (const auto& reference : project.referencedProjects(projects))
+  {
+    file << (first ? "" : ",") << endl;
+    file << "        { \"name\": \"" << escape(reference->fullName()) << "\", \"type\": \"" << edgeType(project,*reference) << "\" }";
+    first=false;
+  }
+  file << (first ? "" : "\n      ") << "]," << endl;
+  file << "      \"cost\": " << costs[index] << "," << endl;
+  file << "      \"finish\": " << finishTimes[index] << endl;
+  file << "    }";
+}
@@ -0,0 +1,42 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#pragma once
+#include "stdafx.h"
+
+#include "BuildTimings.h"
+#include "Options.h"
+#include "Project.h"
+
+class BuildGraph
+{
+public:
+  static void write(const Options &options,const vector<Project> &projects,const optional<BuildTimings> &timings);
+
+private:
+  static const wstring edgeType(const Project &project,const Project &reference);
+
+  static const vector<double> estimateCosts(const Options &options,const vector<Project> &projects);
+
+  static const wstring escape(const wstring &value);
+
+  static void writeList(wofstream &file,const wstring &name,const wstring &values);
+
+  static void writeNode(wofstream &file,const Options &options,const vector<Project> &projects,const size_t index,const vector<double> &costs,const vector<double> &finishTimes);
+};
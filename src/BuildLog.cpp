@@ -0,0 +1,100 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "BuildLog.h"
+
+BuildLog::BuildLog()
+{
+}
+
+BuildLog BuildLog::load(const wstring &fileName)
+{
+  BuildLog
+    log;
+
+  wifstream
+    file;
+
+  wstring
+    line;
+
+  bool
+    projectSummary;
+
+  file.open(filesystem::path(fileName).c_str());
+  if (!file)
+    throwException(L"Unable to open timings file: " + fileName);
+
+  projectSummary=false;
+  while (getline(file,line))
+  {
+    line=trim(line);
+    if (log.loadCompilerTime(line))
+      continue;
+
+    if (line == L"Project Performance Summary:")
+      projectSummary=true;
+    else if (endsWith(line,L"Performance Summary:"))
+      projectSummary=false;
+    else if (projectSummary)
+      log.loadProjectTime(line);
+  }
+
+  if (log._fileDurations.empty() && log._projectDurations.empty())
+    throwException(L"No build timings found in: " + fileName);
+
+  return(log);
+}
+
+bool BuildLog::loadCompilerTime(const wstring &line)
+{
+  // cl /Bt+ writes one line per compiler pass, for example:
+  // time(C:\...\c1.dll)=0.06201s < 25476468585 - 25476709232 > BB [C:\ImageMagick\MagickCore\resize.c]
+  if (!startsWith(line,L"time("))
+    return(false);
+
+  const auto timeStart=line.find(L")=");
+  const auto timeEnd=line.find(L"s ",timeStart);
+  const auto fileStart=line.find(L'[',timeEnd);
+  const auto fileEnd=line.rfind(L']');
+  if (timeStart == wstring::npos || timeEnd == wstring::npos || fileStart == wstring::npos || fileEnd == wstring::npos || fileEnd < fileStart)
+    return(false);
+
+  const auto seconds=wcstod(line.substr(timeStart + 2,timeEnd - timeStart - 2).c_str(),NULL);
+  const auto fileName=toLower(line.substr(fileStart + 1,fileEnd - fileStart - 1));
+  _fileDurations[fileName]+=seconds * 1000.0;
+  return(true);
+}
+
+bool BuildLog::loadProjectTime(const wstring &line)
+{
+  // The PerformanceSummary of msbuild lists the projects like this:
+  // 123456 ms  C:\ImageMagick\ProjectFiles\x64\CORE_zlib\CORE_zlib.vcxproj   1 calls
+  const auto msOffset=line.find(L" ms ");
+  const auto projectEnd=line.find(L".vcxproj");
+  if (msOffset == wstring::npos || projectEnd == wstring::npos)
+    return(false);
+
+  const auto milliseconds=wcstod(line.substr(0,msOffset).c_str(),NULL);
+  const auto projectFile=trim(line.substr(msOffset + 4,projectEnd - msOffset - 4));
+  const auto nameStart=projectFile.find_last_of(L"\\/");
+  const auto projectName=nameStart == wstring::npos ? projectFile : projectFile.substr(nameStart + 1);
+  _projectDurations[toLower(projectName)]+=milliseconds;
+  return(true);
+}
@@ -0,0 +1,41 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#pragma once
+#include "stdafx.h"
+
+class BuildLog
+{
+public:
+  const map<wstring,double>& fileDurations() const { return(_fileDurations); }
+
+  const map<wstring,double>& projectDurations() const { return(_projectDurations); }
+
+  static BuildLog load(const wstring &fileName);
+
+private:
+  BuildLog();
+
+  bool loadCompilerTime(const wstring &line);
+
+  bool loadProjectTime(const wstring &line);
+
+  map<wstring,double> _fileDurations;
+  map<wstring,double> _projectDurations;
+};
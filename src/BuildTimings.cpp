@@ -0,0 +1,156 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "BuildTimings.h"
+#include "ProjectGraph.h"
+
+BuildTimings::BuildTimings()
+{
+}
+
+const vector<double> BuildTimings::costs(const vector<Project> &projects) const
+{
+  vector<double>
+    costs;
+
+  for (const auto& project : projects)
+  {
+    auto duration=projectDuration(project);
+    if (!duration)
+    {
+      duration=0.0;
+      for (const auto& file : project.files())
+      {
+        const auto fileTime=fileDuration(project.directory() + file);
+        if (fileTime)
+          *duration+=*fileTime;
+      }
+    }
+    costs.push_back(*duration);
+  }
+
+  return(costs);
+}
+
+const optional<double> BuildTimings::fileDuration(const wstring &fileName) const
+{
+  const auto duration=_fileDurations.find(toLower(fileName));
+  if (duration == _fileDurations.end())
+    return(nullopt);
+
+  return(duration->second);
+}
+
+optional<BuildTimings> BuildTimings::load(const Options &options)
+{
+  if (options.timingsFile.empty())
+    return(nullopt);
+
+  const auto log=BuildLog::load(options.timingsFile);
+
+  BuildTimings timings;
+  timings._projectDurations=log.projectDurations();
+
+  // The compiler reports absolute paths, the projects use paths relative to the root directory.
+  map<wstring,double> fileDurations;
+  const auto rootDirectory=toLower(options.rootDirectory);
+  for (const auto& duration : log.fileDurations())
+  {
+    if (startsWith(duration.first,rootDirectory))
+      fileDurations[duration.first.substr(rootDirectory.length())]+=duration.second;
+    else
+      fileDurations[duration.first]+=duration.second;
+  }
+  timings._fileDurations=fileDurations;
+
+  return(timings);
+}
+
+void BuildTimings::order(vector<Project> &projects) const
+{
+  const ProjectGraph graph(projects);
+  const auto remainingTimes=graph.remainingTimes(costs(projects));
+
+  vector<size_t> order(projects.size());
+  iota(order.begin(),order.end(),0);
+  stable_sort(order.begin(),order.end(),[&remainingTimes](size_t a,size_t b) { return(remainingTimes[a] > remainingTimes[b]); });
+
+  vector<Project> orderedProjects;
+  for (const auto& index : order)
+    orderedProjects.push_back(projects[index]);
+
+  projects.swap(orderedProjects);
+}
+
+const optional<double> BuildTimings::projectDuration(const Project &project) const
+{
+  const auto duration=_projectDurations.find(toLower(project.fullName()));
+  if (duration == _projectDurations.end())
+    return(nullopt);
+
+  return(duration->second);
+}
+
+void BuildTimings::writeReport(const Options &options,const vector<Project> &projects) const
+{
+  const auto reportFileName=options.rootDirectory + L"Artifacts\\build-timings.txt";
+  filesystem::create_directories(filesystem::path(reportFileName).parent_path());
+
+  wofstream file(reportFileName);
+  if (!file)
+    throwException(L"Failed to open file: " + reportFileName);
+
+  const ProjectGraph graph(projects);
+  const auto projectCosts=costs(projects);
+  const auto criticalPath=graph.criticalPath(projectCosts);
+  const auto finishTimes=graph.finishTimes(projectCosts);
+
+  file << fixed << setprecision(0);
+  file << "Critical path";
+  if (!criticalPath.empty())
+    file << " (" << finishTimes[criticalPath.back()] << " ms)";
+  file << ":" << endl;
+  for (const auto& index : criticalPath)
+    file << setw(10) << projectCosts[index] << " ms  " << projects[index].fullName() << endl;
+  file << endl;
+
+  vector<pair<double,wstring>> files;
+  for (const auto& project : projects)
+  {
+    for (const auto& fileName : project.files())
+    {
+      const auto duration=fileDuration(project.directory() + fileName);
+      if (duration)
+        files.push_back(make_pair(*duration,project.directory() + fileName + L" (" + project.fullName() + L")"));
+    }
+  }
+  sort(files.begin(),files.end(),[](const auto &a,const auto &b) { return(a.first > b.first); });
+
+  file << "Slowest translation units:" << endl;
+  for (size_t i=0; i < files.size() && i < 50; i++)
+    file << setw(10) << files[i].first << " ms  " << files[i].second << endl;
+  file << endl;
+
+  file << "Projects without build timings:" << endl;
+  for (size_t i=0; i < projects.size(); i++)
+  {
+    if (!projectDuration(projects[i]) && projectCosts[i] == 0.0)
+      file << "  " << projects[i].fullName() << endl;
+  }
+}
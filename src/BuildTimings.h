@@ -0,0 +1,47 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#pragma once
+#include "stdafx.h"
+
+#include "BuildLog.h"
+#include "Options.h"
+#include "Project.h"
+
+class BuildTimings
+{
+public:
+  const vector<double> costs(const vector<Project> &projects) const;
+
+  const optional<double> fileDuration(const wstring &fileName) const;
+
+  static optional<BuildTimings> load(const Options &options);
+
+  void order(vector<Project> &projects) const;
+
+  const optional<double> projectDuration(const Project &project) const;
+
+  void writeReport(const Options &options,const vector<Project> &projects) const;
+
+private:
+  BuildTimings();
+
+  map<wstring,double> _fileDurations;
+  map<wstring,double> _projectDurations;
+};
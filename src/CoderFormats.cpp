@@ -0,0 +1,131 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "CoderFormats.h"
+
+map<wstring,set<wstring>> CoderFormats::load(const Options &options,const vector<Project> &projects)
+{
+  map<wstring,set<wstring>>
+    formats;
+
+  for (const auto& project : projects)
+  {
+    if (project.type() != ProjectType::Coder)
+      continue;
+
+    for (const auto& file : project.files())
+    {
+      if (!endsWith(file,L".c"))
+        continue;
+
+      const auto coder=filesystem::path(file).stem().wstring();
+      if (formats.find(coder) == formats.end())
+        formats[coder]=loadFormats(options.rootDirectory + project.directory() + file);
+    }
+  }
+
+  return(formats);
+}
+
+set<wstring> CoderFormats::loadFormats(const wstring &fileName)
+{
+  wifstream file(fileName);
+  if (!file)
+    throwException(L"Unable to open: " + fileName);
+
+  wstringstream content;
+  content << file.rdbuf();
+  const auto source=content.str();
+
+  set<wstring> formats;
+  size_t offset=0;
+  while ((offset=source.find(L"AcquireMagickInfo(",offset)) != wstring::npos)
+  {
+    // The first argument is the module and the second one the format: AcquireMagickInfo("PNG","PNG8",...
+    offset+=wcslen(L"AcquireMagickInfo(");
+    const auto module=readString(source,offset);
+    const auto format=readString(source,offset);
+    if (!module.empty() && !format.empty())
+      formats.insert(format);
+  }
+
+  return(formats);
+}
+
+wstring CoderFormats::readString(const wstring &source,size_t &offset)
+{
+  const auto start=source.find(L'"',offset);
+  if (start == wstring::npos || start > source.find(L')',offset))
+    return(L"");
+
+  const auto end=source.find(L'"',start + 1);
+  if (end == wstring::npos)
+    return(L"");
+
+  offset=end + 1;
+  return(source.substr(start + 1,end - start - 1));
+}
+
+void CoderFormats::writeModuleIndex(const Options &options,const vector<Project> &projects)
+{
+  const auto formats=load(options,projects);
+
+  writeModuleIndex(options,formats);
+  for (const auto& variant : options.variants)
+    writeModuleIndex(options.variantOptions(variant),formats);
+}
+
+void CoderFormats::writeModuleIndex(const Options &options,const map<wstring,set<wstring>> &formats)
+{
+  const auto binDirectory=options.rootDirectory + options.artifactsDirectory(L"bin");
+  filesystem::create_directories(binDirectory);
+
+  wstringstream index;
+
+  index << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>" << endl;
+  index << "<modulemap>" << endl;
+  for (const auto& coder : formats)
+  {
+    for (const auto& format : coder.second)
+      index << "  <module magick=\"" << format << "\" name=\"" << toUpper(coder.first) << "\"/>" << endl;
+  }
+  index << "</modulemap>" << endl;
+
+  writeFileIfChanged(binDirectory + L"\\modules.xml",index.str());
+}
+
+void CoderFormats::writeRegistrationTable(const Options &options,const vector<Project> &projects)
+{
+  const auto directory=options.rootDirectory + L"Artifacts\\generated\\coders";
+  filesystem::create_directories(directory);
+
+  wstringstream table;
+
+  // A coder without known formats has an empty list and must be registered at startup.
+  for (const auto& coder : load(options,projects))
+  {
+    wstring formats;
+    for (const auto& format : coder.second)
+      formats+=(formats.empty() ? L"" : L";") + format;
+
+    table << "AddMagickStaticCoder(" << toUpper(coder.first) << ",\"" << formats << "\")" << endl;
+  }
+
+  writeFileIfChanged(directory + L"\\coders-table.h",table.str());
+}
@@ -0,0 +1,41 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#pragma once
+#include "stdafx.h"
+
+#include "Options.h"
+#include "Project.h"
+
+class CoderFormats
+{
+public:
+  static map<wstring,set<wstring>> load(const Options &options,const vector<Project> &projects);
+
+  static void writeModuleIndex(const Options &options,const vector<Project> &projects);
+
+  static void writeRegistrationTable(const Options &options,const vector<Project> &projects);
+
+private:
+  static set<wstring> loadFormats(const wstring &fileName);
+
+  static wstring readString(const wstring &source,size_t &offset);
+
+  static void writeModuleIndex(const Options &options,const map<wstring,set<wstring>> &formats);
+};
@@ -0,0 +1,39 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "CoderList.h"
+
+void CoderList::write(const Options &options,const vector<Project> &projects)
+{
+  const auto directory=options.rootDirectory + L"Artifacts\\generated\\coders";
+
+  for (const auto& project : projects)
+  {
+    if (project.coders().empty())
+      continue;
+
+    wstringstream codersList;
+
+    for (const auto& coder : project.coders())
+      codersList << "AddMagickCoder(" << toUpper(coder) << ")" << endl;
+
+    filesystem::create_directories(directory);
+    writeFileIfChanged(directory + L"\\coders-list.h",codersList.str());
+  }
+}
@@ -25,15 +25,87 @@ CommandLineInfo::CommandLineInfo(Options &options)
   showWizard=true;
 }
 
+bool CommandLineInfo::parseValue(const wchar_t* pszParam,const wchar_t* name,wstring &value)
+{
+  const auto length=wcslen(name);
+  if (_wcsnicmp(pszParam,name,length) != 0 || pszParam[length] != L':')
+    return(false);
+
+  value=wstring(pszParam + length + 1);
+  return(true);
+}
+
 void CommandLineInfo::ParseParam(const wchar_t* pszParam, BOOL bFlag, BOOL bLast)
 {
+  wstring
+    value;
+
   if (!bFlag)
     return;
 
+  // Only for dynamic builds, the coders are built into MagickCore and ImageMagick needs to register them when MAGICKCORE_CORE_CODERS is defined.
+  if (parseValue(pszParam,L"coreCoders",value))
+  {
+    _options->coreCoders=split(value,L',');
+    return;
+  }
+  if (parseValue(pszParam,L"fingerprints",_options->fingerprintsFile))
+    return;
+  if (parseValue(pszParam,L"formats",value))
+  {
+    _options->formats=split(value,L',');
+    return;
+  }
+  if (parseValue(pszParam,L"graph",_options->graphFile))
+    return;
+  if (parseValue(pszParam,L"pgoCorpus",_options->pgoCorpus))
+  {
+    _options->pgo=_options->ltcg=TRUE;
+    return;
+  }
+  if (parseValue(pszParam,L"prebuilt",_options->prebuiltFile))
+    return;
+  if (parseValue(pszParam,L"targets",value))
+  {
+    _options->targets=split(value,L',');
+    return;
+  }
+  if (parseValue(pszParam,L"timings",_options->timingsFile))
+    return;
+  if (parseValue(pszParam,L"toolset",value))
+  {
+    if (_wcsicmp(value.c_str(),L"clangcl") == 0)
+      _options->toolset=Toolset::ClangCL;
+    else if (_wcsicmp(value.c_str(),L"msvc") == 0)
+      _options->toolset=Toolset::MSVC;
+    else
+      throwException(L"Unknown toolset: " + value);
+    return;
+  }
+  if (parseValue(pszParam,L"variants",value))
+  {
+    _options->variants=split(value,L',');
+    return;
+  }
+
   if (_wcsicmp(pszParam, L"arm64") == 0)
+  {
     _options->architecture=Architecture::Arm64;
+    _options->instructionSet=InstructionSet::Baseline;
+  }
+  else if (_wcsicmp(pszParam, L"arm64ec") == 0)
+  {
+    _options->architecture=Architecture::Arm64EC;
+    _options->instructionSet=InstructionSet::Baseline;
+  }
+  else if (_wcsicmp(pszParam, L"cacheable") == 0)
+    _options->cacheable=TRUE;
   else if (_wcsicmp(pszParam, L"deprecated") == 0)
     _options->excludeDeprecated=FALSE;
+  else if (_wcsicmp(pszParam, L"delayLoad") == 0)
+    _options->delayLoad=TRUE;
+  else if (_wcsicmp(pszParam, L"developerLink") == 0)
+    _options->developerLink=TRUE;
   else if (_wcsicmp(pszParam, L"dynamic") == 0)
     _options->isStaticBuild=FALSE;
   else if (_wcsicmp(pszParam, L"hdri") == 0)
@@ -54,16 +126,34 @@ void CommandLineInfo::ParseParam(const wchar_t* pszParam, BOOL bFlag, BOOL bLast
     _options->useOpenMP=FALSE;
   else if (_wcsicmp(pszParam, L"noWizard") == 0)
     showWizard=false;
+  // Only for static builds, this writes Artifacts\generated\coders\coders-table.h with AddMagickStaticCoder entries
+  // and defines MAGICKCORE_LAZY_CODER_REGISTRATION. Nothing in the ImageMagick sources includes that table yet, so
+  // the coders are still registered at startup until static.c is changed to use it.
+  else if (_wcsicmp(pszParam, L"lazyCoders") == 0)
+    _options->lazyCoders=TRUE;
   else if (_wcsicmp(pszParam, L"limitedPolicy") == 0)
     _options->policyConfig=PolicyConfig::Limited;
   else if (_wcsicmp(pszParam, L"linkRuntime") == 0)
     _options->linkRuntime=TRUE;
+  else if (_wcsicmp(pszParam, L"ltcg") == 0)
+    _options->ltcg=TRUE;
+  else if (_wcsicmp(pszParam, L"ltcgDependencies") == 0)
+    _options->ltcg=_options->ltcgDependencies=TRUE;
+  else if (_wcsicmp(pszParam, L"ltcgIncremental") == 0)
+    _options->ltcg=_options->ltcgIncremental=TRUE;
+  else if (_wcsicmp(pszParam, L"magickAliases") == 0)
+  {
+    _options->magickAliases=TRUE;
+    _options->onlyMagick=FALSE;
+  }
   else if (_wcsicmp(pszParam, L"onlyMagick") == 0)
     _options->onlyMagick=TRUE;
   else if (_wcsicmp(pszParam, L"openCL") == 0)
     _options->useOpenCL=TRUE;
   else if (_wcsicmp(pszParam, L"openPolicy") == 0)
     _options->policyConfig=PolicyConfig::Open;
+  else if (_wcsicmp(pszParam, L"pgo") == 0)
+    _options->pgo=_options->ltcg=TRUE;
   else if (_wcsicmp(pszParam, L"Q8") == 0)
     _options->quantumDepth=QuantumDepth::Q8;
   else if (_wcsicmp(pszParam, L"Q16") == 0)
@@ -77,9 +167,30 @@ void CommandLineInfo::ParseParam(const wchar_t* pszParam, BOOL bFlag, BOOL bLast
   else if (_wcsicmp(pszParam, L"static") == 0)
     _options->isStaticBuild=TRUE;
   else if (_wcsicmp(pszParam, L"x86") == 0)
+  {
     _options->architecture=Architecture::x86;
+    _options->instructionSet=InstructionSet::Baseline;
+  }
   else if (_wcsicmp(pszParam, L"x64") == 0)
+  {
+    _options->architecture=Architecture::x64;
+    _options->instructionSet=InstructionSet::Baseline;
+  }
+  else if (_wcsicmp(pszParam, L"x64-v2") == 0)
+  {
+    _options->architecture=Architecture::x64;
+    _options->instructionSet=InstructionSet::x64v2;
+  }
+  else if (_wcsicmp(pszParam, L"x64-v3") == 0)
+  {
+    _options->architecture=Architecture::x64;
+    _options->instructionSet=InstructionSet::x64v3;
+  }
+  else if (_wcsicmp(pszParam, L"x64-v4") == 0)
+  {
     _options->architecture=Architecture::x64;
+    _options->instructionSet=InstructionSet::x64v4;
+  }
   else if (_wcsicmp(pszParam, L"VS2017") == 0)
     _options->visualStudioVersion=VisualStudioVersion::VS2017;
   else if (_wcsicmp(pszParam, L"VS2019") == 0)
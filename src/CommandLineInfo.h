@@ -32,5 +32,7 @@ public:
   virtual void ParseParam(const wchar_t* pszParam, BOOL bFlag, BOOL bLast);
 
 private:
+  static bool parseValue(const wchar_t* pszParam,const wchar_t* name,wstring &value);
+
   Options* _options;
 };
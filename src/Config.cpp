@@ -28,6 +28,7 @@ Config::Config(const wstring &name,const wstring &directory)
   _isOptional=false;
   _isImageMagick7Only=false;
   _isMagickProject=false;
+  _isMsvcOnly=false;
   _type=ProjectType::Undefined;
   _useNasm=false;
   _useOpenCL=false;
@@ -38,7 +39,9 @@ const set<wstring>& Config::excludes(const Architecture architecture) const
 {
   switch (architecture)
   {
-    case Architecture::Arm64: return(_excludesArm64);
+    case Architecture::Arm64:
+    case Architecture::Arm64EC:
+      return(_excludesArm64);
     case Architecture::x64: return(_excludesX64);
     case Architecture::x86: return(_excludesX86);
     default: throwException(L"Unknown architecture");
@@ -57,24 +60,13 @@ const set<wstring>& Config::nasmIncludes(const Architecture architecture) const
 
 void Config::addIncludeArtifacts(wifstream &config)
 {
-  set<wstring>
+  map<wstring,wstring>
     artifacts;
 
-  addLines(config,artifacts);
+  addMappings(config,artifacts);
 
   for (const auto& artifact : artifacts)
-  {
-    size_t offset=artifact.find(L" -> ");
-    if (offset == wstring::npos)
-      throwException(L"Invalid include artifact: " + artifact);
-
-    wstring source=_directory + artifact.substr(0,offset);
-    wstring target=artifact.substr(offset + 4);
-    if (target == L".")
-      _includeArtifacts[source]=L"";
-    else
-      _includeArtifacts[source]=target;
-  }
+    _includeArtifacts[_directory + artifact.first]=artifact.second == L"." ? L"" : artifact.second;
 }
 
 void Config::addIncludes(wifstream &config,set<wstring> &container)
@@ -105,6 +97,32 @@ void Config::addLines(wifstream &config,set<wstring> &container)
     container.insert(line);
 }
 
+void Config::addMappings(wifstream &config,map<wstring,wstring> &container)
+{
+  for (const auto& line : readLines(config))
+  {
+    size_t offset=line.find(L" -> ");
+    if (offset == wstring::npos)
+      throwException(L"Invalid mapping: " + line);
+
+    container[trim(line.substr(0,offset))]=trim(line.substr(offset + 4));
+  }
+}
+
+void Config::addOptimizations(wifstream &config)
+{
+  static const set<wstring>
+    levels = { L"Disabled", L"Full", L"MaxSpeed", L"MinSpace" };
+
+  addMappings(config,_fileOptimizations);
+
+  for (const auto& optimization : _fileOptimizations)
+  {
+    if (levels.find(optimization.second) == levels.end())
+      throwException(L"Invalid optimization level " + optimization.second + L" for: " + optimization.first);
+  }
+}
+
 const Config Config::copyInfo(const Config &config) const
 {
   Config newConfig(*this);
@@ -121,6 +139,15 @@ const Config Config::copyInfo(const Config &config) const
   for (auto& references : config._coderReferences)
     newConfig._coderReferences.insert(references);
 
+  for (auto& delayLoad : config._delayLoad)
+    newConfig._delayLoad.insert(delayLoad);
+
+  for (auto& fileOption : config._fileOptions)
+    newConfig._fileOptions.insert({ config.relativePath(fileOption.first,_directory), fileOption.second });
+
+  for (auto& fileOptimization : config._fileOptimizations)
+    newConfig._fileOptimizations.insert({ config.relativePath(fileOptimization.first,_directory), fileOptimization.second });
+
   return(newConfig);
 }
 
@@ -149,7 +176,8 @@ void Config::load(const wstring &configFile)
   set<wstring>
     defines,
     excludes,
-    includesNasm;
+    includesNasm,
+    neon;
 
   if (!filesystem::exists(configFile))
     throwException(L"Unable to open config file: " + configFile);
@@ -160,16 +188,22 @@ void Config::load(const wstring &configFile)
     line=readLine(config);
     if (line == L"[APPLICATION]")
       _type=ProjectType::Application;
+    else if (line == L"[ASM_ARM64]")
+      addLines(config,_asmArm64);
     else if (line == L"[CODER]")
       _type=ProjectType::Coder;
     else if (line == L"[CODER_REFERENCES]")
       addLines(config,_coderReferences);
     else if (line == L"[DEFINES]")
       addLines(config,defines);
+    else if (line == L"[DELAY_LOAD]")
+      addLines(config,_delayLoad);
     else if (line == L"[DEMO]")
       _type=ProjectType::Demo;
     else if (line == L"[DYNAMIC_LIBRARY]")
       _type=ProjectType::DynamicLibrary;
+    else if (line == L"[FILE_OPTIONS]")
+      addMappings(config,_fileOptions);
     else if (line == L"[FILTER]")
       _type=ProjectType::Filter;
     else if (line == L"[FUZZ]")
@@ -208,12 +242,18 @@ void Config::load(const wstring &configFile)
       _isMagickProject=true;
     else if (line == L"[MODULE_DEFINITION_FILE]")
       _moduleDefinitionFile=readLine(config);
+    else if (line == L"[MSVC_ONLY]")
+      _isMsvcOnly=true;
     else if (line == L"[NASM]")
       _useNasm=true;
     else if (line == L"[ONLY_IMAGEMAGICK7]")
       _isImageMagick7Only=true;
+    else if (line == L"[NEON]")
+      addLines(config,neon);
     else if (line == L"[OPENCL]")
       _useOpenCL=true;
+    else if (line == L"[OPTIMIZATION]")
+      addOptimizations(config);
     else if (line == L"[OPTIONAL]")
       _isOptional=true;
     else if (line == L"[STATIC_LIBRARY]")
@@ -241,6 +281,19 @@ void Config::load(const wstring &configFile)
     _excludesX86.insert(exclude);
   }
 
+  // The Arm64 SIMD sources are only part of the build on Arm64.
+  for (const auto& exclude : _asmArm64)
+  {
+    _excludesX64.insert(exclude);
+    _excludesX86.insert(exclude);
+  }
+
+  for (const auto& exclude : neon)
+  {
+    _excludesX64.insert(exclude);
+    _excludesX86.insert(exclude);
+  }
+
   for (const auto& include : includesNasm)
   {
     _includesNasmX64.insert(include);
@@ -257,9 +310,15 @@ void Config::rename(const wstring& name)
   _name=name;
 }
 
+void Config::removeCoderReference(const wstring& name)
+{
+  _coderReferences.erase(name);
+}
+
 void Config::removeReference(const wstring& name)
 {
   _references.erase(name);
+  _delayLoad.erase(name);
 }
 
 wstring Config::readLine(wifstream &stream)
@@ -288,6 +347,15 @@ vector<wstring> Config::readLines(wifstream &config)
   return(lines);
 }
 
+const wstring Config::relativePath(const wstring &path,const wstring &directory) const
+{
+  // The paths in the config are relative to its own directory, e.g. a coder that is added to MagickCore.
+  if (_directory == directory)
+    return(path);
+
+  return(filesystem::path(_directory + path).lexically_relative(directory).wstring());
+}
+
 void Config::updateForImageMagick6()
 {
   if (_name == L"MagickCore")
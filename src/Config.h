@@ -25,8 +25,12 @@
 class Config
 {
 public:
+  const set<wstring>& asmArm64() const { return(_asmArm64); }
+
   const set<wstring>& coderReferences() const { return(_coderReferences); }
 
+  const set<wstring>& delayLoad() const { return(_delayLoad); }
+
   const wstring directory() const { return(_directory); }
 
   const bool disabledForArm64() const { return(_disabledForArm64); }
@@ -37,6 +41,10 @@ public:
 
   const set<wstring>& excludes(const Architecture architecture) const;
 
+  const map<wstring,wstring>& fileOptimizations() const { return(_fileOptimizations); }
+
+  const map<wstring,wstring>& fileOptions() const { return(_fileOptions); }
+
   const wstring name() const { return(_name); }
 
   const set<wstring>& includes() const { return(_includes); }
@@ -51,6 +59,8 @@ public:
 
   const bool isOptional() const { return(_isOptional); }
 
+  const bool isMsvcOnly() const { return(_isMsvcOnly); }
+
   const set<wstring>& licenses() const { return(_licenses); }
 
   const wstring magickBaseconfigDefine() const { return(_magickBaseconfigDefine); }
@@ -81,6 +91,8 @@ public:
 
   void rename(const wstring& name);
 
+  void removeCoderReference(const wstring& name);
+
   void removeReference(const wstring& name);
 
   void updateForImageMagick6();
@@ -96,18 +108,28 @@ private:
 
   static void addLines(wifstream &config,set<wstring> &container);
 
+  static void addMappings(wifstream &config,map<wstring,wstring> &container);
+
+  void addOptimizations(wifstream &config);
+
   void load(const wstring &configFile);
 
   static wstring readLine(wifstream &stream);
 
   static vector<wstring> readLines(wifstream &config);
+
+  const wstring relativePath(const wstring &path,const wstring &directory) const;
   
+  set<wstring> _asmArm64;
   set<wstring> _coderReferences;
+  set<wstring> _delayLoad;
   bool _disabledForArm64;
   set<wstring> _dynamicDefines;
   set<wstring> _excludesArm64;
   set<wstring> _excludesX64;
   set<wstring> _excludesX86;
+  map<wstring,wstring> _fileOptimizations;
+  map<wstring,wstring> _fileOptions;
   bool _hasIncompatibleLicense;
   set<wstring> _includes;
   set<wstring> _includesNasm;
@@ -116,6 +138,7 @@ private:
   map<wstring,wstring> _includeArtifacts;
   bool _isImageMagick7Only;
   bool _isMagickProject;
+  bool _isMsvcOnly;
   bool _isOptional;
   set<wstring> _licenses;
   wstring _magickBaseconfigDefine;
@@ -18,6 +18,8 @@
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 */
 #include "Configs.h"
+#include "License.h"
+#include "MagickBaseConfig.h"
 
 void Configs::addConfig(Config &config,const Options &options,vector<Config> &configs)
 {
@@ -27,7 +29,7 @@ void Configs::addConfig(Config &config,const Options &options,vector<Config> &co
   if (config.hasIncompatibleLicense() && !options.includeIncompatibleLicense)
     return;
 
-  if (config.disabledForArm64() && options.architecture == Architecture::Arm64)
+  if (config.disabledForArm64() && options.isArm64())
     return;
 
   if (config.isImageMagick7Only() && !options.isImageMagick7)
@@ -48,6 +50,7 @@ vector<Config> Configs::load(const Options &options)
     configs;
 
   loadDependencies(options,configs);
+  removePrebuiltLibraries(options,configs);
   loadImageMagick(options,configs);
   removeInvalidReferences(options,configs);
   validate(options,configs);
@@ -185,7 +188,7 @@ void Configs::removeInvalidReferences(const Options &options,vector<Config> &con
         }
       }
 
-      if (!found && !filesystem::exists(options.rootDirectory + L"Artifacts\\include\\" + reference))
+      if (!found && options.prebuiltLibraries().count(reference) == 0 && !filesystem::exists(options.rootDirectory + L"Artifacts\\include\\" + reference))
         invalidReferences.insert(reference);
     }
 
@@ -194,6 +197,25 @@ void Configs::removeInvalidReferences(const Options &options,vector<Config> &con
   }
 }
 
+void Configs::removePrebuiltLibraries(const Options &options,vector<Config> &configs)
+{
+  if (options.prebuiltLibraries().empty())
+    return;
+
+  // The license and the delegate define of a library are still needed when the prebuilt library replaces its project.
+  for (const auto& config : configs)
+  {
+    if (options.prebuiltLibraries().count(config.name()) == 0)
+      continue;
+
+    if (!config.licenses().empty())
+      License::write(options,config,config.name());
+    MagickBaseConfig::writeDefine(options,config,config.name());
+  }
+
+  configs.erase(remove_if(configs.begin(),configs.end(),[&](const Config &config) { return(options.prebuiltLibraries().count(config.name()) > 0); }),configs.end());
+}
+
 void Configs::validate(const Options &options,const vector<Config> &configs)
 {
   for (const auto& config : configs)
@@ -212,5 +234,11 @@ void Configs::validate(const Options &options,const vector<Config> &configs)
 
     if (!config.references().empty() && config.type() == ProjectType::StaticLibrary)
       throwException(L"A static library should have no references");
+
+    for (const auto& delayLoad : config.delayLoad())
+    {
+      if (config.references().find(delayLoad) == config.references().end())
+        throwException(L"Delay loaded library " + delayLoad + L" is not a reference of " + config.name());
+    }
   }
 }
@@ -47,5 +47,7 @@ private:
 
   static void removeInvalidReferences(const Options &options,vector<Config> &configs);
 
+  static void removePrebuiltLibraries(const Options &options,vector<Config> &configs);
+
   static void validate(const Options &options,const vector<Config> &configs);
 };
@@ -19,6 +19,11 @@
 */
 #include "ConfigureApp.h"
 
+#include "BuildFingerprints.h"
+#include "BuildGraph.h"
+#include "BuildTimings.h"
+#include "CoderFormats.h"
+#include "CoderList.h"
 #include "Configs.h"
 #include "ConfigureWizard.h"
 #include "CommandLineInfo.h"
@@ -28,6 +33,7 @@
 #include "Notice.h"
 #include "Options.h"
 #include "PerlMagick.h"
+#include "ProfileGuidedOptimization.h"
 #include "Project.h"
 #include "Projects.h"
 #include "Solution.h"
@@ -88,9 +94,9 @@ void ConfigureApp::cleanupDirectories(Options &options,WaitDialog &waitDialog)
 #endif
 }
 
-void ConfigureApp::copyFiles(Options &options)
+void ConfigureApp::copyFiles(const Options &options)
 {
-  const auto binDirectory=options.rootDirectory + L"Artifacts\\bin";
+  const auto binDirectory=options.rootDirectory + options.artifactsDirectory(L"bin");
 
   if (!filesystem::exists(binDirectory))
     filesystem::create_directories(binDirectory);
@@ -99,6 +105,31 @@ void ConfigureApp::copyFiles(Options &options)
   copyFiles(options.rootDirectory + L"Configure\\ColorProfiles",binDirectory);
 }
 
+void ConfigureApp::copyPrebuiltLibraries(const Options &options)
+{
+  vector<wstring> binDirectories = { options.rootDirectory + options.artifactsDirectory(L"bin") };
+  for (const auto& variant : options.variants)
+    binDirectories.push_back(options.rootDirectory + options.variantOptions(variant).artifactsDirectory(L"bin"));
+
+  for (const auto& prebuiltLibrary : options.prebuiltLibraries())
+  {
+    for (const auto& dll : { prebuiltLibrary.second.dll(true), prebuiltLibrary.second.dll(false) })
+    {
+      if (dll.empty())
+        continue;
+
+      if (!filesystem::exists(dll))
+        throwException(L"Unable to find the dll of prebuilt library " + prebuiltLibrary.first + L": " + dll);
+
+      for (const auto& binDirectory : binDirectories)
+      {
+        filesystem::create_directories(binDirectory);
+        filesystem::copy(dll,binDirectory + L"\\" + filesystem::path(dll).filename().wstring(),filesystem::copy_options::overwrite_existing);
+      }
+    }
+  }
+}
+
 void ConfigureApp::copyFiles(const wstring &sourceDirectory,const wstring &targetDirectory)
 {
   for (const auto& entry : filesystem::directory_iterator(sourceDirectory))
@@ -110,7 +141,7 @@ void ConfigureApp::copyFiles(const wstring &sourceDirectory,const wstring &targe
 
 BOOL ConfigureApp::createFiles(Options &options,WaitDialog &waitDialog) const
 {
-  waitDialog.setSteps(16);
+  waitDialog.setSteps(25);
 
   waitDialog.nextStep(L"Cleaning up directories...");
   cleanupDirectories(options,waitDialog);
@@ -124,17 +155,63 @@ BOOL ConfigureApp::createFiles(Options &options,WaitDialog &waitDialog) const
   }
 
   waitDialog.nextStep(L"Loading configuration files...");
+  options.loadPrebuiltLibraries();
+  copyPrebuiltLibraries(options);
   vector<Config> configs=Configs::load(options);
 
   waitDialog.nextStep(L"Creating projects...");
   vector<Project> projects=Projects::create(options,configs);
 
+  if (!options.targets.empty())
+  {
+    waitDialog.nextStep(L"Pruning projects...");
+    Projects::prune(options,projects);
+  }
+
+  optional<BuildTimings> timings=BuildTimings::load(options);
+  if (timings)
+  {
+    waitDialog.nextStep(L"Writing build timings report...");
+    timings->writeReport(options,projects);
+    timings->order(projects);
+  }
+
   waitDialog.nextStep(L"Writing project files...");
   Projects::write(projects);
 
+  if (!options.coreCoders.empty() || !options.formats.empty())
+  {
+    waitDialog.nextStep(L"Writing coders list...");
+    CoderList::write(options,projects);
+  }
+
+  if (!options.isStaticBuild)
+  {
+    waitDialog.nextStep(L"Writing module index...");
+    CoderFormats::writeModuleIndex(options,projects);
+  }
+
+  if (options.lazyCoders && options.isStaticBuild)
+  {
+    waitDialog.nextStep(L"Writing coder registration table...");
+    CoderFormats::writeRegistrationTable(options,projects);
+  }
+
   waitDialog.nextStep(L"Writing solution files...");
   Solution::write(options,projects);
 
+  if (!options.graphFile.empty())
+  {
+    waitDialog.nextStep(L"Writing build graph...");
+    BuildGraph::write(options,projects,timings);
+  }
+
+  if (options.pgo)
+  {
+    waitDialog.nextStep(L"Writing profile guided optimization scripts...");
+    ProfileGuidedOptimization::write(options,projects);
+  }
+
   if (options.includeNonWindows)
   {
     waitDialog.nextStep(L"Writing non windows licenses...");
@@ -144,6 +221,13 @@ BOOL ConfigureApp::createFiles(Options &options,WaitDialog &waitDialog) const
   if (versionInfo)
     writeImageMagickFiles(options,*versionInfo,waitDialog);
 
+  // The fingerprints include the generated headers so they are written last.
+  if (!options.fingerprintsFile.empty())
+  {
+    waitDialog.nextStep(L"Writing build fingerprints...");
+    BuildFingerprints::write(options,projects);
+  }
+
   return(TRUE);
 }
 
@@ -183,4 +267,26 @@ void ConfigureApp::writeImageMagickFiles(const Options &options,const VersionInf
 
   waitDialog.nextStep(L"Writing installer configuration...");
   InstallerConfig::write(options,versionInfo);
+
+  if (!options.variants.empty())
+    writeVariantFiles(options,waitDialog);
+}
+
+void ConfigureApp::writeVariantFiles(const Options &options,WaitDialog &waitDialog) const
+{
+  waitDialog.nextStep(L"Writing variant files...");
+
+  for (const auto& variant : options.variants)
+  {
+    const auto variantOptions=options.variantOptions(variant);
+
+    copyFiles(variantOptions);
+
+    optional<VersionInfo> versionInfo=VersionInfo::load(variantOptions);
+    if (versionInfo)
+      versionInfo->write();
+
+    MagickBaseConfig::write(variantOptions);
+    XmlConfigFiles::write(variantOptions);
+  }
 }
@@ -37,13 +37,17 @@ private:
 
   static void cleanupDirectories(Options &options,WaitDialog &waitDialog);
 
-  static void copyFiles(Options &options);
+  static void copyFiles(const Options &options);
 
   static void copyFiles(const wstring &sourceDirectory,const wstring &targetDirectory);
 
+  static void copyPrebuiltLibraries(const Options &options);
+
   BOOL createFiles(Options &options,WaitDialog &waitDialog) const;
 
   const wstring getRootDirectory() const;
 
   void writeImageMagickFiles(const Options &options,const VersionInfo &versionInfo,WaitDialog &waitDialog) const;
+
+  void writeVariantFiles(const Options &options,WaitDialog &waitDialog) const;
 };
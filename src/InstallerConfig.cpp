@@ -37,13 +37,14 @@ void InstallerConfig::write(const Options &options,const VersionInfo &versionInf
   else
   {
     configFile << L"#define public MagickDynamicPackage 1" << endl;
-    if (options.architecture != Architecture::Arm64)
+    if (!options.isArm64())
       configFile << L"#define public MagickPerlMagick 1" << endl;
   }
 
   switch (options.architecture)
   {
     case Architecture::Arm64:
+    case Architecture::Arm64EC:
       configFile << L"#define public MagickArm64Architecture 1" << endl;
       break;
     case Architecture::x64:
@@ -25,10 +25,11 @@ void MagickBaseConfig::write(const Options &options)
   if (!configIn)
     throwException(L"Unable to open magick-baseconfig.h.in");
 
-  const auto directory=options.rootDirectory + L"ImageMagick\\" + options.magickCoreName();
-  wofstream configOut(directory + L"\\magick-baseconfig.h");
-  if (!configOut)
-    throwException(L"Unable to open magick-baseconfig.h");
+  auto directory=options.rootDirectory + L"ImageMagick\\" + options.magickCoreName();
+  if (!options.variant.empty())
+    directory=options.rootDirectory + options.variantDirectory() + L"\\" + options.magickCoreName();
+  filesystem::create_directories(directory);
+  wstringstream configOut;
 
   wstring line;
   while (getline(configIn,line))
@@ -135,4 +136,22 @@ void MagickBaseConfig::write(const Options &options)
       configOut << versionFile.rdbuf() << endl;
     }
   }
+
+  writeFileIfChanged(directory + L"\\magick-baseconfig.h",configOut.str());
+}
+
+void MagickBaseConfig::writeDefine(const Options &options,const Config &config,const wstring name)
+{
+  if (config.magickBaseconfigDefine().empty())
+    return;
+
+  const auto targetDirectory=options.rootDirectory + L"Artifacts\\config\\";
+  filesystem::create_directories(targetDirectory);
+
+  const auto configFileName=targetDirectory + name + L".h";
+  wofstream configFile(configFileName);
+  if (!configFile)
+    throwException(L"Failed to open license file: " + configFileName);
+
+  configFile << config.magickBaseconfigDefine();
 }
@@ -20,10 +20,13 @@
 #pragma once
 #include "stdafx.h"
 
+#include "Config.h"
 #include "Options.h"
 
 class MagickBaseConfig
 {
 public:
   static void write(const Options &options);
+
+  static void writeDefine(const Options &options,const Config &config,const wstring name);
 };
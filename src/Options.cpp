@@ -10,6 +10,9 @@ Options::Options(const wstring &rootDirectory)
 #else
   architecture=Architecture::x64;
 #endif
+  cacheable=FALSE;
+  delayLoad=FALSE;
+  developerLink=FALSE;
   enableDpc=TRUE;
   excludeDeprecated=TRUE;
 #ifdef DEBUG
@@ -21,12 +24,20 @@ Options::Options(const wstring &rootDirectory)
 #endif
   includeNonWindows=FALSE;
   installedSupport=FALSE;
+  instructionSet=InstructionSet::Baseline;
   isImageMagick7=TRUE;
   isStaticBuild=TRUE;
+  lazyCoders=FALSE;
   linkRuntime=FALSE;
+  ltcg=FALSE;
+  ltcgDependencies=FALSE;
+  ltcgIncremental=FALSE;
+  magickAliases=FALSE;
   onlyMagick=TRUE;
+  pgo=FALSE;
   policyConfig=PolicyConfig::Open;
   quantumDepth=QuantumDepth::Q16;
+  toolset=Toolset::MSVC;
   useHDRI=TRUE;
   useOpenCL=TRUE;
   useOpenMP=FALSE;
@@ -48,6 +59,19 @@ Options::Options(const wstring &rootDirectory)
   }
 }
 
+const wstring Options::abi() const
+{
+  wstring
+    abi;
+
+  abi=architectureName();
+  abi+=isStaticBuild ? L".static" : L".dynamic";
+  abi+=linkRuntime ? L".MT" : L".MD";
+  abi+=L"." + (toolset == Toolset::ClangCL ? L"ClangCL" : platformToolset());
+
+  return(abi);
+}
+
 const wstring Options::architectureName() const
 {
   switch (architecture)
@@ -55,10 +79,25 @@ const wstring Options::architectureName() const
     case Architecture::x86: return(L"x86");
     case Architecture::x64: return(L"x64");
     case Architecture::Arm64: return(L"arm64");
+    case Architecture::Arm64EC: return(L"arm64ec");
     default: throwException(L"Unknown architecture");
   }
 }
 
+const wstring Options::artifactsDirectory(const wstring &name) const
+{
+  wstring
+    directory;
+
+  directory=L"Artifacts\\" + name;
+  if (instructionSet != InstructionSet::Baseline)
+    directory+=L"\\" + instructionSetName();
+  if (!variant.empty())
+    directory+=L"\\" + variant;
+
+  return(directory);
+}
+
 const wstring Options::channelMaskDepth() const
 {
   if (!isImageMagick7)
@@ -70,6 +109,26 @@ const wstring Options::channelMaskDepth() const
     return(L"32");
 }
 
+const vector<wstring> Options::configurations() const
+{
+  if (pgo)
+    return(vector<wstring> { L"Debug", L"Release", L"PGInstrument", L"PGOptimize" });
+
+  return(vector<wstring> { L"Debug", L"Release" });
+}
+
+const wstring Options::instructionSetName() const
+{
+  switch (instructionSet)
+  {
+    case InstructionSet::Baseline: return(architectureName());
+    case InstructionSet::x64v2: return(L"x64-v2");
+    case InstructionSet::x64v3: return(L"x64-v3");
+    case InstructionSet::x64v4: return(L"x64-v4");
+    default: throwException(L"Unknown instruction set");
+  }
+}
+
 const wstring Options::platform() const
 {
   switch (architecture)
@@ -77,13 +136,55 @@ const wstring Options::platform() const
     case Architecture::x86: return(L"Win32");
     case Architecture::x64: return(L"x64");
     case Architecture::Arm64: return(L"ARM64");
+    case Architecture::Arm64EC: return(L"ARM64EC");
     default: throwException(L"Unknown architecture");
   }
 }
 
+const wstring Options::platformToolset() const
+{
+  switch (visualStudioVersion)
+  {
+    case VisualStudioVersion::VS2022: return(L"v143");
+    case VisualStudioVersion::VS2019: return(L"v142");
+    case VisualStudioVersion::VS2017: return(L"v141");
+    default: throwException(L"Unknown Visual Studio version");
+  }
+}
+
 const wstring Options::projectsDirectory() const
 {
-  return(L"ProjectFiles\\" + architectureName() + L"\\");
+  return(L"ProjectFiles\\" + instructionSetName() + L"\\");
+}
+
+const Options Options::variantOptions(const wstring &name) const
+{
+  Options
+    options(*this);
+
+  const auto separator=name.find(L'-');
+  const auto quantumDepthName=name.substr(0,separator);
+  if (_wcsicmp(quantumDepthName.c_str(),L"Q8") == 0)
+    options.quantumDepth=QuantumDepth::Q8;
+  else if (_wcsicmp(quantumDepthName.c_str(),L"Q16") == 0)
+    options.quantumDepth=QuantumDepth::Q16;
+  else if (_wcsicmp(quantumDepthName.c_str(),L"Q32") == 0)
+    options.quantumDepth=QuantumDepth::Q32;
+  else if (_wcsicmp(quantumDepthName.c_str(),L"Q64") == 0)
+    options.quantumDepth=QuantumDepth::Q64;
+  else
+    throwException(L"Invalid variant: " + name);
+
+  if (separator == wstring::npos)
+    options.useHDRI=FALSE;
+  else if (_wcsicmp(name.substr(separator + 1).c_str(),L"HDRI") == 0 && isImageMagick7)
+    options.useHDRI=TRUE;
+  else
+    throwException(L"Invalid variant: " + name);
+
+  options.variant=name;
+
+  return(options);
 }
 
 void Options::checkImageMagickVersion()
@@ -95,6 +196,12 @@ void Options::checkImageMagickVersion()
   }
 }
 
+void Options::loadPrebuiltLibraries()
+{
+  if (!prebuiltFile.empty())
+    _prebuiltLibraries=PrebuiltLibrary::load(prebuiltFile,abi());
+}
+
 wstring Options::getEnvironmentVariable(const wchar_t *name)
 {
   wchar_t
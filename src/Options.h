@@ -20,45 +20,88 @@
 #pragma once
 #include "stdafx.h"
 
+#include "PrebuiltLibrary.h"
+
 class Options
 {
 public:
   Options(const wstring &rootDirectory);
 
   Architecture architecture;
+  BOOL cacheable;
+  vector<wstring> coreCoders;
+  BOOL delayLoad;
+  BOOL developerLink;
   BOOL enableDpc;
   BOOL excludeDeprecated;
+  wstring fingerprintsFile;
+  vector<wstring> formats;
+  wstring graphFile;
   BOOL includeIncompatibleLicense;
   BOOL includeNonWindows;
   BOOL includeOptional;
   BOOL installedSupport;
+  InstructionSet instructionSet;
   BOOL isStaticBuild;
+  BOOL lazyCoders;
   BOOL linkRuntime;
+  BOOL ltcg;
+  BOOL ltcgDependencies;
+  BOOL ltcgIncremental;
+  BOOL magickAliases;
   BOOL onlyMagick;
+  BOOL pgo;
+  wstring pgoCorpus;
   PolicyConfig policyConfig;
+  wstring prebuiltFile;
   QuantumDepth quantumDepth;
   wstring rootDirectory;
+  vector<wstring> targets;
+  wstring timingsFile;
+  Toolset toolset;
   BOOL useHDRI;
   BOOL useOpenCL;
   BOOL useOpenMP;
   bool isImageMagick7;
+  wstring variant;
+  vector<wstring> variants;
   VisualStudioVersion visualStudioVersion;
   BOOL zeroConfigurationSupport;
 
+  const wstring abi() const;
+
   const wstring architectureName() const;
 
+  const wstring artifactsDirectory(const wstring &name) const;
+
   const set<wstring>& preBuildLibs() const { return(_preBuildLibs); };
 
   const wstring channelMaskDepth() const;
 
+  const wstring instructionSetName() const;
+
+  const bool isArm64() const { return(architecture == Architecture::Arm64 || architecture == Architecture::Arm64EC); };
+
+  const vector<wstring> configurations() const;
+
   const wstring magickCoreName() const { return(isImageMagick7 ? L"MagickCore" : L"magick"); };
 
   const wstring platform() const;
 
+  const wstring platformToolset() const;
+
+  const map<wstring,PrebuiltLibrary>& prebuiltLibraries() const { return(_prebuiltLibraries); };
+
   const wstring projectsDirectory() const;
 
+  const wstring variantDirectory() const { return(L"Artifacts\\variants\\" + variant); };
+
+  const Options variantOptions(const wstring &name) const;
+
   void checkImageMagickVersion();
 
+  void loadPrebuiltLibraries();
+
 private:
   static wstring getEnvironmentVariable(const wchar_t *name);
 
@@ -66,5 +109,6 @@ private:
   
   static bool hasVisualStudioDirectory(const wchar_t *name);
 
+  map<wstring,PrebuiltLibrary> _prebuiltLibraries;
   set<wstring> _preBuildLibs;
 };
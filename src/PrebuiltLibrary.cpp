@@ -0,0 +1,107 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "PrebuiltLibrary.h"
+
+PrebuiltLibrary::PrebuiltLibrary(const wstring &name)
+  : _name(name)
+{
+}
+
+map<wstring,PrebuiltLibrary> PrebuiltLibrary::load(const wstring &fileName,const wstring &abi)
+{
+  map<wstring,PrebuiltLibrary>
+    libraries;
+
+  vector<PrebuiltLibrary>
+    entries;
+
+  wstring
+    line;
+
+  wifstream manifest(fileName);
+  if (!manifest)
+    throwException(L"Unable to open prebuilt manifest: " + fileName);
+
+  const auto directory=filesystem::absolute(fileName).parent_path().wstring() + L"\\";
+
+  while (getline(manifest,line))
+  {
+    line=trim(line);
+    if (line.empty() || line[0] == L'#')
+      continue;
+
+    if (line[0] == L'[' && line[line.length() - 1] == L']')
+    {
+      entries.push_back(PrebuiltLibrary(line.substr(1,line.length() - 2)));
+      continue;
+    }
+
+    const auto offset=line.find(L" -> ");
+    if (offset == wstring::npos || entries.empty())
+      throwException(L"Invalid line in prebuilt manifest: " + line);
+
+    entries.back().setValue(trim(line.substr(0,offset)),trim(line.substr(offset + 4)),directory);
+  }
+
+  // The manifest can describe the same library for multiple builds, only the entries with our ABI are used.
+  for (const auto& entry : entries)
+  {
+    if (entry._includeDirectory.empty() || entry._library.empty())
+      throwException(L"Prebuilt library " + entry._name + L" needs an include directory and a library");
+
+    if (_wcsicmp(entry._abi.c_str(),abi.c_str()) != 0)
+      continue;
+
+    if (libraries.find(entry._name) != libraries.end())
+      throwException(L"Prebuilt library " + entry._name + L" is specified more than once for " + abi);
+
+    libraries.insert({ entry._name, entry });
+  }
+
+  return(libraries);
+}
+
+void PrebuiltLibrary::setValue(const wstring &key,const wstring &value,const wstring &directory)
+{
+  const auto path=filesystem::path(value).is_absolute() ? value : directory + value;
+
+  if (key == L"abi")
+    _abi=value;
+  else if (key == L"debugDll")
+    _debugDll=path;
+  else if (key == L"debugLibrary")
+    _debugLibrary=path;
+  else if (key == L"dll")
+  {
+    _dll=path;
+    if (_debugDll.empty())
+      _debugDll=path;
+  }
+  else if (key == L"include")
+    _includeDirectory=path;
+  else if (key == L"library")
+  {
+    _library=path;
+    if (_debugLibrary.empty())
+      _debugLibrary=path;
+  }
+  else
+    throwException(L"Unknown key in prebuilt manifest: " + key);
+}
@@ -0,0 +1,48 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#pragma once
+#include "stdafx.h"
+
+class PrebuiltLibrary
+{
+public:
+  const wstring dll(bool debug) const { return(debug ? _debugDll : _dll); };
+
+  const wstring includeDirectory() const { return(_includeDirectory); };
+
+  const wstring library(bool debug) const { return(debug ? _debugLibrary : _library); };
+
+  const wstring name() const { return(_name); };
+
+  static map<wstring,PrebuiltLibrary> load(const wstring &fileName,const wstring &abi);
+
+private:
+  PrebuiltLibrary(const wstring &name);
+
+  void setValue(const wstring &key,const wstring &value,const wstring &directory);
+
+  wstring _abi;
+  wstring _debugDll;
+  wstring _debugLibrary;
+  wstring _dll;
+  wstring _includeDirectory;
+  wstring _library;
+  wstring _name;
+};
@@ -0,0 +1,98 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "ProfileGuidedOptimization.h"
+#include "ProjectGraph.h"
+#include "Solution.h"
+
+void ProfileGuidedOptimization::write(const Options &options,const vector<Project> &projects)
+{
+  if (!options.pgo)
+    return;
+
+  const auto directory=options.rootDirectory + options.artifactsDirectory(L"pgo") + L"\\";
+  filesystem::create_directories(directory);
+
+  writeTrainScript(options,projects,directory);
+  writePipelineScript(options,directory);
+}
+
+const wstring ProfileGuidedOptimization::rootDirectory(const Options &options)
+{
+  wstring
+    directory(L"%~dp0..\\");
+
+  for (const auto& c : options.artifactsDirectory(L"pgo"))
+  {
+    if (c == L'\\')
+      directory+=L"..\\";
+  }
+
+  return(directory);
+}
+
+void ProfileGuidedOptimization::writePipelineScript(const Options &options,const wstring &directory)
+{
+  const auto fileName=directory + L"Pgo.cmd";
+  wofstream file(fileName);
+  if (!file)
+    throwException(L"Failed to open file: " + fileName);
+
+  const auto build=L"msbuild \"%SOLUTION%\" /m /p:Platform=" + options.architectureName();
+
+  file << "@echo off" << endl;
+  file << "setlocal" << endl;
+  file << "set SOLUTION=" << rootDirectory(options) << Solution::solutionName(options) << endl;
+  file << build << " /p:Configuration=PGInstrument || exit /b 1" << endl;
+  file << "call \"%~dp0Train.cmd\" %1 || exit /b 1" << endl;
+  file << build << " /p:Configuration=PGOptimize || exit /b 1" << endl;
+}
+
+void ProfileGuidedOptimization::writeTrainScript(const Options &options,const vector<Project> &projects,const wstring &directory)
+{
+  const auto name=options.isImageMagick7 ? L"magick" : L"convert";
+  const auto indices=ProjectGraph(projects).find(name);
+  if (indices.empty())
+    throwException(L"Unable to find the training executable: " + wstring(name));
+
+  const auto corpus=options.pgoCorpus.empty() ? L"%~dp0corpus.txt" : filesystem::absolute(options.pgoCorpus).wstring();
+
+  const auto fileName=directory + L"Train.cmd";
+  wofstream file(fileName);
+  if (!file)
+    throwException(L"Failed to open file: " + fileName);
+
+  // Every line of the corpus contains the arguments of one command, relative to the directory of the corpus.
+  file << "@echo off" << endl;
+  file << "setlocal" << endl;
+  file << "if not defined VCToolsInstallDir echo Run this script from a Visual Studio developer command prompt & exit /b 1" << endl;
+  file << "set PGOMGR=%VCToolsInstallDir%bin\\Host%VSCMD_ARG_HOST_ARCH%\\%VSCMD_ARG_HOST_ARCH%\\pgomgr.exe" << endl;
+  // The instrumented binaries are written to the PGInstrument directory, the configuration files stay in the bin directory.
+  file << "set BIN=" << rootDirectory(options) << options.artifactsDirectory(L"bin") << "\\PGInstrument\\" << endl;
+  file << "set MAGICK=%BIN%" << filesystem::path(projects[indices.front()].outputFileName(false)).filename().wstring() << endl;
+  file << "set MAGICK_CONFIGURE_PATH=" << rootDirectory(options) << options.artifactsDirectory(L"bin") << "\\" << endl;
+  file << "set CORPUS=" << corpus << endl;
+  file << "if not \"%~1\"==\"\" set CORPUS=%~f1" << endl;
+  file << "if not exist \"%CORPUS%\" echo Unable to find corpus: %CORPUS% & exit /b 1" << endl;
+  file << "del /q \"%BIN%*.pgc\" 2>nul" << endl;
+  file << "for %%c in (\"%CORPUS%\") do pushd \"%%~dpc\"" << endl;
+  file << "for /f \"usebackq eol=# delims=\" %%a in (\"%CORPUS%\") do \"%MAGICK%\" %%a" << endl;
+  file << "popd" << endl;
+  file << "for %%p in (\"%~dp0*.pgd\") do if exist \"%BIN%%%~np!*.pgc\" \"%PGOMGR%\" /merge \"%BIN%%%~np!*.pgc\" \"%%p\"" << endl;
+}
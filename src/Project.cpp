@@ -19,6 +19,7 @@
 */
 #include "Project.h"
 #include "License.h"
+#include "MagickBaseConfig.h"
 
 Project::Project(const Config &config,const Options &options)
   : _config(config),
@@ -26,11 +27,140 @@ Project::Project(const Config &config,const Options &options)
 {
 }
 
+const wstring Project::armAssemblerOptions() const
+{
+  wstring
+    options=_options.architecture == Architecture::Arm64EC ? L" --target=arm64ec-pc-windows-msvc /nologo /c" : L" --target=arm64-pc-windows-msvc /nologo /c";
+
+  for (const auto& define : split(defines(),L';'))
+    options+=L" /D" + define;
+
+  // A trailing backslash would escape the closing quote.
+  for (auto directory : split(includeDirectories(),L';'))
+  {
+    if (endsWith(directory,L"\\"))
+      directory.pop_back();
+    options+=L" /I\"" + directory + L"\"";
+  }
+
+  return(options);
+}
+
+const wstring Project::assemblyDependencies(const wstring &sourceName) const
+{
+  set<wstring>
+    dependencies;
+
+  wstring
+    result;
+
+  const auto sourceFile=filesystem::path(_options.rootDirectory + _config.directory() + sourceName);
+
+  if (_config.useNasm())
+  {
+    // NASM looks in the current directory, which is the directory of the project file, and then in the -i directories.
+    vector<filesystem::path> directories = { filesystem::path(_options.rootDirectory + fileName()).parent_path() };
+    for (const auto& include : _config.nasmIncludes(_options.architecture))
+      directories.push_back(filesystem::path(_options.rootDirectory + _config.directory() + include));
+
+    assemblyDependencies(sourceFile,L"%include",directories,dependencies);
+  }
+  else
+  {
+    // armasm64 looks in the directory of the source file.
+    assemblyDependencies(sourceFile,L"INCLUDE",{ sourceFile.parent_path() },dependencies);
+  }
+
+  for (const auto& dependency : dependencies)
+  {
+    if (startsWith(dependency,_options.rootDirectory))
+      result+=L"$(SolutionDir)" + dependency.substr(_options.rootDirectory.length()) + L";";
+    else
+      result+=dependency + L";";
+  }
+
+  return(result);
+}
+
+void Project::assemblyDependencies(const filesystem::path &sourceFile,const wstring &directive,const vector<filesystem::path> &directories,set<wstring> &dependencies) const
+{
+  wifstream
+    file;
+
+  wstring
+    line;
+
+  file.open(sourceFile);
+  if (!file)
+    return;
+
+  while (getline(file,line))
+  {
+    line=trim(line);
+    if (line.length() <= directive.length() || _wcsnicmp(line.c_str(),directive.c_str(),directive.length()) != 0 || !iswspace(line[directive.length()]))
+      continue;
+
+    auto includeName=trim(line.substr(directive.length()));
+    if (includeName.empty())
+      continue;
+
+    if (includeName[0] == L'"' || includeName[0] == L'\'' || includeName[0] == L'<')
+    {
+      const auto end=includeName.find(includeName[0] == L'<' ? L'>' : includeName[0],1);
+      if (end == wstring::npos)
+        continue;
+
+      includeName=includeName.substr(1,end - 1);
+    }
+    else
+      includeName=includeName.substr(0,includeName.find_first_of(L" \t;"));
+
+    for (const auto& directory : directories)
+    {
+      const auto candidate=directory / includeName;
+      if (!filesystem::exists(candidate))
+        continue;
+
+      const auto dependency=candidate.lexically_normal().wstring();
+      if (dependencies.insert(dependency).second)
+        assemblyDependencies(candidate,directive,directories,dependencies);
+      break;
+    }
+  }
+}
+
 const wstring Project::characterSet() const
 {
   return(_config.useUnicode() ? L"Unicode" : L"MultiByte");
 }
 
+const wstring Project::compilerOptions() const
+{
+  wstring options=L"/source-charset:utf-8";
+
+  if (_options.cacheable)
+  {
+    // /Brepro removes the timestamps from the objects. The checkout directory is also stripped from the paths
+    // in the objects so they do not depend on where the sources are. MSVC has no documented switch for that,
+    // /d1trimfile is the one that all supported versions accept. The directory ends with a backslash so it is
+    // doubled to keep the closing quote.
+    options+=L" /Brepro";
+    if (useClang())
+      options+=L" \"/clang:-ffile-prefix-map=$(SolutionDir)=\\ImageMagick\\\\\"";
+    else
+      options+=L" \"/d1trimfile:$(SolutionDir)\\\"";
+  }
+  if (_options.instructionSet == InstructionSet::x64v2)
+    options+=useClang() ? L" /clang:-march=x86-64-v2" : L" /arch:SSE4.2";
+  if (useClang() && _options.useOpenMP)
+    options+=L" /openmp";
+  // Level4 of clang-cl also enables -Wextra, these warnings are not reported by the MSVC level.
+  if (useClang() && _options.isImageMagick7 && _config.isMagickProject())
+    options+=L" -Wno-unused-parameter -Wno-sign-compare -Wno-missing-field-initializers";
+
+  return(options);
+}
+
 const Compiler Project::compiler() const
 {
   return(_config.isMagickProject() && _options.visualStudioVersion >= VisualStudioVersion::VS2022
@@ -57,16 +187,67 @@ const wstring Project::defines() const
     defines+=L";_LIB";
     for (auto& define : _config.staticDefines())
       defines+=L";" + define;
+    if (isLazyCoderRegistration())
+      defines+=L";MAGICKCORE_LAZY_CODER_REGISTRATION";
   }
   else
   {
     for (auto& define : _config.dynamicDefines())
       defines+=L";" + define;
+    // The core coders are only registered when static.c of ImageMagick checks for MAGICKCORE_CORE_CODERS.
+    if (!_coders.empty())
+      defines+=L";MAGICKCORE_CORE_CODERS";
   }
 
   return(defines);
 }
 
+const wstring Project::enhancedInstructionSet() const
+{
+  switch (_options.instructionSet)
+  {
+    case InstructionSet::x64v3: return(L"AdvancedVectorExtensions2");
+    case InstructionSet::x64v4: return(L"AdvancedVectorExtensions512");
+    default: return(L"");
+  }
+}
+
+const wstring Project::fileOptimization(const wstring &fileName) const
+{
+  wstring
+    optimization;
+
+  for (const auto& fileOptimization : _config.fileOptimizations())
+  {
+    if (matchesGlob(fileName,fileOptimization.first))
+      optimization=fileOptimization.second;
+  }
+
+  return(optimization);
+}
+
+const wstring Project::fileOptions(const wstring &fileName) const
+{
+  wstring
+    options;
+
+  for (const auto& fileOption : _config.fileOptions())
+  {
+    if (matchesGlob(fileName,fileOption.first))
+      options+=L" " + fileOption.second;
+  }
+
+  return(options);
+}
+
+const wstring Project::fullName() const
+{
+  if (_options.variant.empty())
+    return(prefix() + L"_" + name());
+
+  return(prefix() + L"_" + name() + L"_" + _options.variant);
+}
+
 const bool Project::hasAsmfiles() const
 {
   for (const auto& file : _files)
@@ -82,8 +263,16 @@ const wstring Project::includeDirectories() const
 {
   wstring directories;
 
+  // The generated headers of a variant must be found before the ones in the ImageMagick directory.
+  if (!_options.variant.empty())
+    directories=L"$(SolutionDir)" + _options.variantDirectory() + L";";
+
+  // The generated coders-list.h must be found before the one in the coders directory.
+  if (!_coders.empty() || isLazyCoderRegistration())
+    directories+=L"$(SolutionDir)Artifacts\\generated;";
+
   if (_config.includes().empty())
-    directories=L"$(SolutionDir)" + _config.directory() + L";";
+    directories+=L"$(SolutionDir)" + _config.directory() + L";";
 
   for (const auto& include : _config.includes())
   {
@@ -97,7 +286,13 @@ const wstring Project::includeDirectories() const
   }
 
   for (const auto& reference : _config.references())
-    directories+=L"$(SolutionDir)Artifacts\\include\\" + reference + L";";
+  {
+    const auto prebuiltLibrary=_options.prebuiltLibraries().find(reference);
+    if (prebuiltLibrary != _options.prebuiltLibraries().end())
+      directories+=prebuiltLibrary->second.includeDirectory() + L";";
+    else
+      directories+=L"$(SolutionDir)Artifacts\\include\\" + reference + L";";
+  }
 
   if (_options.useOpenCL && _config.useOpenCL())
     directories+=L"$(SolutionDir)Configure\\OpenCL";
@@ -118,12 +313,41 @@ const bool Project::isApplication() const
   }
 }
 
+const bool Project::isLazyCoderRegistration() const
+{
+  return(_options.lazyCoders && _options.isStaticBuild && name() == _options.magickCoreName());
+}
+
+const bool Project::isSameVariant(const Project &project) const
+{
+  // The dependencies are shared by all variants.
+  return(project.variant().empty() || project.variant() == variant());
+}
+
+const wstring Project::libraryDirectories() const
+{
+  wstring
+    directories;
+
+  directories=L"$(SolutionDir)" + _options.artifactsDirectory(L"lib") + profileDirectory() + L";";
+  if (!_options.variant.empty())
+  {
+    // The projects that are shared by the variants are in the directory of the instruction set.
+    directories+=L"$(SolutionDir)Artifacts\\lib";
+    if (_options.instructionSet != InstructionSet::Baseline)
+      directories+=L"\\" + _options.instructionSetName();
+    directories+=profileDirectory() + L";";
+  }
+
+  return(directories);
+}
+
 const wstring Project::nasmOptions() const
 {
   wstring
     options=L"";
 
-  if (_options.architecture == Architecture::Arm64)
+  if (_options.isArm64())
     throwException(L"NASM is not supported for Arm64 architecture");
 
   if (_options.architecture == Architecture::x64)
@@ -140,7 +364,8 @@ const wstring Project::nasmOptions() const
 
 const wstring Project::openMPSupport() const
 {
-  return(_options.useOpenMP ? L"true" : L"false");
+  // The ClangCL toolset gets /openmp as an additional option instead.
+  return(_options.useOpenMP && !useClang() ? L"true" : L"false");
 }
 
 const wstring Project::outputDirectory() const
@@ -159,15 +384,33 @@ const wstring Project::outputDirectory() const
   }
 }
 
+const wstring Project::outputFileName(bool debug) const
+{
+  const auto type=configurationType();
+  const auto extension=type == L"Application" ? L".exe" : type == L"DynamicLibrary" ? L".dll" : L".lib";
+
+  return(_options.artifactsDirectory(outputDirectory()) + L"\\" + targetName(debug) + extension);
+}
+
 const wstring Project::platformToolset() const
 {
-  switch (_options.visualStudioVersion)
+  if (_options.architecture == Architecture::Arm64EC && _options.visualStudioVersion < VisualStudioVersion::VS2022)
+    throwException(L"Arm64EC requires Visual Studio 2022 or newer");
+
+  if (_options.instructionSet == InstructionSet::x64v2 && !useClang() && _options.visualStudioVersion < VisualStudioVersion::VS2022)
+    throwException(L"The x64-v2 instruction set requires Visual Studio 2022 or newer");
+
+  if (_options.developerLink && _options.visualStudioVersion < VisualStudioVersion::VS2019)
+    throwException(L"The developer link profile requires Visual Studio 2019 or newer");
+
+  if (useClang())
   {
-    case VisualStudioVersion::VS2022: return(L"v143");
-    case VisualStudioVersion::VS2019: return(L"v142");
-    case VisualStudioVersion::VS2017: return(L"v141");
-    default: throwException(L"Unknown architecture");
+    if (_options.visualStudioVersion < VisualStudioVersion::VS2019)
+      throwException(L"The ClangCL toolset requires Visual Studio 2019 or newer");
+    return(L"ClangCL");
   }
+
+  return(_options.platformToolset());
 }
 
 const wstring Project::prefix() const
@@ -187,6 +430,21 @@ const wstring Project::prefix() const
   }
 }
 
+const wstring Project::profileDirectory() const
+{
+  return(_options.pgo ? L"$(ProfileDirectory)" : L"");
+}
+
+const bool Project::useClang() const
+{
+  return(_options.toolset == Toolset::ClangCL && !_config.isMsvcOnly());
+}
+
+const bool Project::useTrackedImportLibrary() const
+{
+  return(_options.developerLink && configurationType() == L"DynamicLibrary");
+}
+
 const wstring Project::warningLevel() const
 {
   if (_options.isImageMagick7 && _config.isMagickProject())
@@ -195,12 +453,37 @@ const wstring Project::warningLevel() const
     return(L"TurnOffAllWarnings");
 }
 
-const wstring Project::additionalDependencies(const bool debug) const
+const bool Project::wholeProgramOptimization() const
+{
+  // Objects of an MSVC only project cannot be combined with LLVM bitcode at link time.
+  if (_options.toolset == Toolset::ClangCL && _config.isMsvcOnly())
+    return(false);
+
+  return(_options.ltcg && (_config.isMagickProject() || _options.ltcgDependencies));
+}
+
+const wstring Project::additionalDependencies(const bool debug,const vector<Project> &allProjects) const
 {
   wstring dependencies;
 
   for (auto& reference : _config.references())
-    dependencies+=(debug ? L"CORE_DB_" : L"CORE_RL_") + reference + L"_.lib;";
+  {
+    const auto prebuiltLibrary=_options.prebuiltLibraries().find(reference);
+    if (prebuiltLibrary != _options.prebuiltLibraries().end())
+      dependencies+=prebuiltLibrary->second.library(debug) + L";";
+    else
+      dependencies+=(debug ? L"CORE_DB_" : L"CORE_RL_") + reference + L"_.lib;";
+  }
+
+  // The prebuilt libraries are not project references, a static application has to link the ones its references use.
+  if (_options.isStaticBuild && isApplication())
+  {
+    for (auto& reference : prebuiltReferences(allProjects))
+    {
+      if (_config.references().count(reference) == 0)
+        dependencies+=_options.prebuiltLibraries().at(reference).library(debug) + L";";
+    }
+  }
 
   if (!_options.isStaticBuild)
   {
@@ -208,9 +491,49 @@ const wstring Project::additionalDependencies(const bool debug) const
       dependencies+=(debug ? L"IM_MOD_DB_" : L"IM_MOD_RL_") + reference + L"_.lib;";
   }
 
+  if (_options.delayLoad && !_options.isStaticBuild && !_config.delayLoad().empty())
+    dependencies+=L"delayimp.lib;";
+
+  if (useClang() && _options.useOpenMP)
+    dependencies+=L"libomp.lib;";
+
+  // Arm64EC emulates the x64 intrinsics that are still used because _M_X64 is defined.
+  if (_options.architecture == Architecture::Arm64EC)
+    dependencies+=L"softintrin.lib;";
+
   return(dependencies);
 }
 
+const wstring Project::delayLoadLibraries(const bool debug,const vector<Project> &allProjects) const
+{
+  wstring libraries;
+
+  // Only the libraries that are built as a DLL by this solution can be delay loaded.
+  for (const auto& reference : _config.delayLoad())
+  {
+    auto project=find_if(allProjects.begin(),allProjects.end(),[&](const Project& p) { return(p.type() == ProjectType::DynamicLibrary && p.name() == reference && isSameVariant(p)); });
+    if (project != allProjects.end())
+      libraries+=project->targetName(debug) + L".dll;";
+  }
+
+  return(libraries);
+}
+
+void Project::addCoder(const Project &coderProject)
+{
+  for (const auto& file : coderProject._files)
+    _files.insert(filesystem::path(coderProject.directory() + file).lexically_relative(directory()).wstring());
+
+  _config=_config.copyInfo(coderProject._config);
+  _config.removeReference(name());
+
+  // The referenced coders are also added to this project.
+  for (const auto& reference : coderProject.coderReferences())
+    _config.removeCoderReference(reference);
+
+  _coders.insert(coderProject.name());
+}
+
 void Project::copyConfigInfo(const Config& config)
 {
   _config=_config.copyInfo(config);
@@ -224,6 +547,14 @@ Project Project::create(const Config &config,const Options &options)
   return(project);
 }
 
+const bool Project::isArm64Assembly(const wstring &fileName) const
+{
+  if (!_options.isArm64())
+    return(false);
+
+  return(any_of(_config.asmArm64().begin(),_config.asmArm64().end(),[&](const auto &path) { return(startsWith(fileName,path)); }));
+}
+
 bool Project::isExcluded(const wstring fileName,set<wstring> &excludes,multiset<wstring> &foundExcludes) const
 {
   if (startsWith(fileName,L".git\\") || startsWith(fileName,L".github\\") || startsWith(fileName,L".ImageMagick\\"))
@@ -269,6 +600,23 @@ void Project::loadFiles()
     if (foundExcludes.find(exclude) == foundExcludes.end())
       throwException(L"Invalid exclude path " + exclude + L" in " + name());
   }
+
+  // The paths are validated against all the files because a path can refer to files that are excluded on this architecture.
+  set<wstring> allFiles;
+  if (!_config.fileOptimizations().empty() || !_config.fileOptions().empty())
+    allFiles=sourceFiles();
+
+  for (const auto& fileOptimization : _config.fileOptimizations())
+  {
+    if (none_of(allFiles.begin(),allFiles.end(),[&](const auto &fileName) { return(matchesGlob(fileName,fileOptimization.first)); }))
+      throwException(L"Invalid optimization path " + fileOptimization.first + L" in " + name());
+  }
+
+  for (const auto& fileOption : _config.fileOptions())
+  {
+    if (none_of(allFiles.begin(),allFiles.end(),[&](const auto &fileName) { return(matchesGlob(fileName,fileOption.first)); }))
+      throwException(L"Invalid file options path " + fileOption.first + L" in " + name());
+  }
 }
 
 void Project::loadFiles(const wstring directory,set<wstring> &excludes,multiset<wstring> &foundExcludes)
@@ -290,16 +638,94 @@ void Project::loadFiles(const wstring directory,set<wstring> &excludes,multiset<
     }
 
     static const set<wstring>
-      validExtensions = { L".asm", L".c", L".cc", L".cpp", L".h" };
+      validExtensions = { L".asm", L".c", L".cc", L".cpp", L".h", L".S" };
 
     if (validExtensions.find(file.path().extension().wstring()) == validExtensions.end())
       continue;
 
-    if (!isExcluded(name,excludes,foundExcludes))
-      _files.insert(name);
+    if (isExcluded(name,excludes,foundExcludes))
+      continue;
+
+    if (endsWith(name,L".S") && !isArm64Assembly(name))
+      continue;
+
+    _files.insert(name);
   }
 }
 
+const set<wstring> Project::prebuiltReferences(const vector<Project> &allProjects) const
+{
+  set<wstring>
+    references;
+
+  set<const Project*>
+    visited;
+
+  vector<const Project*>
+    remaining = { this };
+
+  while (!remaining.empty())
+  {
+    const auto project=remaining.back();
+    remaining.pop_back();
+    if (!visited.insert(project).second)
+      continue;
+
+    for (const auto& reference : project->_config.references())
+    {
+      if (_options.prebuiltLibraries().count(reference) > 0)
+        references.insert(reference);
+    }
+
+    for (const auto& referencedProject : project->referencedProjects(allProjects))
+      remaining.push_back(referencedProject);
+  }
+
+  return(references);
+}
+
+const vector<const Project*> Project::referencedProjects(const vector<Project> &allProjects) const
+{
+  vector<const Project*> projects;
+
+  if (_config.references().empty())
+    return(projects);
+
+  for (const auto& reference : _config.references())
+  {
+    auto project = find_if(allProjects.begin(), allProjects.end(),[&](const Project& p) { return(p.isLibrary() && p.name() == reference && isSameVariant(p)); });
+    if (project == allProjects.end())
+      continue;
+
+    projects.push_back(&project[0]);
+  }
+
+  for (const auto& reference : _config.coderReferences())
+  {
+    auto project = find_if(allProjects.begin(), allProjects.end(),[&](const Project& p) { return(p.type() == ProjectType::Coder && p.name() == reference && isSameVariant(p)); });
+    if (project == allProjects.end())
+      continue;
+
+    projects.push_back(&project[0]);
+  }
+
+  if (isApplication())
+  {
+    for (const auto& project : allProjects)
+    {
+      if ((project.type() == ProjectType::Coder || project.type() == ProjectType::Filter) && isSameVariant(project))
+        projects.push_back(&project);
+    }
+  }
+
+  return(projects);
+}
+
+void Project::removeCoderReference(const wstring& name)
+{
+  _config.removeCoderReference(name);
+}
+
 void Project::rename(const wstring& name)
 {
   _config.rename(name);
@@ -311,6 +737,31 @@ const wstring Project::runtimeLibrary(bool debug) const
   return(prefix + (_options.linkRuntime ? L"" : L"DLL"));
 }
 
+const set<wstring> Project::sourceFiles() const
+{
+  set<wstring>
+    files;
+
+  const auto directory=filesystem::path(_options.rootDirectory + _config.directory());
+  for (const auto& file : filesystem::recursive_directory_iterator(directory))
+  {
+    if (file.is_regular_file())
+      files.insert(file.path().lexically_relative(directory).wstring());
+  }
+
+  return(files);
+}
+
+void Project::setAliases(const vector<wstring> aliases)
+{
+  _aliases=aliases;
+}
+
+void Project::setCoders(const set<wstring> coders)
+{
+  _coders=coders;
+}
+
 void Project::setFiles(const vector<wstring> files)
 {
   _files.clear();
@@ -365,7 +816,7 @@ void Project::write(const vector<Project> &allProjects) const
   if (!file)
     throwException(L"Failed to open file: " + vcxprojFileName);
 
-  const auto includeMasm=hasAsmfiles() && !_config.useNasm() && _options.architecture != Architecture::Arm64;
+  const auto includeMasm=hasAsmfiles() && !_config.useNasm() && !_options.isArm64();
 
   file << "<?xml version=\"1.0\" encoding=\"utf-8\"?>" << endl;
   file << "<Project DefaultTargets=\"Build\" ToolsVersion=\"4.0\" xmlns=\"http://schemas.microsoft.com/developer/msbuild/2003\">" << endl;
@@ -378,11 +829,14 @@ void Project::write(const vector<Project> &allProjects) const
       (_options.isStaticBuild && (_config.type() == ProjectType::DynamicLibrary || _config.type() == ProjectType::Coder)))
     writeLibProperties(file);
   else
-    writeLinkProperties(file);
+    writeLinkProperties(file,allProjects);
   writeFiles(file);
   writeReferences(file,allProjects);
   writeTargetsImports(file,includeMasm);
   writeCopyIncludes(file);
+  writeCopyAliases(file);
+  writeCopyToVariants(file);
+  writeCopyImportLibrary(file);
   file << "</Project>" << endl;
 }
 
@@ -390,7 +844,7 @@ void Project::writeCompilationConfiguration(wofstream &file) const
 {
   file << "  <ItemDefinitionGroup>" << endl;
   file << "    <ClCompile>" << endl;
-  file << "      <AdditionalOptions>/source-charset:utf-8 %(AdditionalOptions)</AdditionalOptions>" << endl;
+  file << "      <AdditionalOptions>" << compilerOptions() << " %(AdditionalOptions)</AdditionalOptions>" << endl;
   file << "      <AdditionalIncludeDirectories>" << includeDirectories() << "%(AdditionalIncludeDirectories)</AdditionalIncludeDirectories>" << endl;
   file << "      <FunctionLevelLinking>true</FunctionLevelLinking>" << endl;
   file << "      <LanguageStandard>stdcpp17</LanguageStandard>" << endl;
@@ -399,26 +853,33 @@ void Project::writeCompilationConfiguration(wofstream &file) const
   file << "      <StringPooling>true</StringPooling>" << endl;
   file << "      <SuppressStartupBanner>true</SuppressStartupBanner>" << endl;
   file << "      <OpenMPSupport>" << openMPSupport() << "</OpenMPSupport>" << endl;
+  if (!enhancedInstructionSet().empty())
+    file << "      <EnableEnhancedInstructionSet>" << enhancedInstructionSet() << "</EnableEnhancedInstructionSet>" << endl;
   file << "      <WarningLevel>" << warningLevel() << "</WarningLevel>" << endl;
-  file << "      <DebugInformationFormat Condition=\"'$(Configuration)'=='Debug'\">ProgramDatabase</DebugInformationFormat>" << endl;
-  file << "      <DebugInformationFormat Condition=\"'$(Configuration)'=='Release'\">None</DebugInformationFormat>" << endl;
+  file << "      <DebugInformationFormat Condition=\"'$(Configuration)'=='Debug'\">" << (_options.cacheable ? "OldStyle" : "ProgramDatabase") << "</DebugInformationFormat>" << endl;
+  file << "      <DebugInformationFormat Condition=\"'$(Configuration)'!='Debug'\">None</DebugInformationFormat>" << endl;
   file << "      <BasicRuntimeChecks Condition=\"'$(Configuration)'=='Debug'\">EnableFastChecks</BasicRuntimeChecks>" << endl;
-  file << "      <BasicRuntimeChecks Condition=\"'$(Configuration)'=='Release'\">Default</BasicRuntimeChecks>" << endl;
+  file << "      <BasicRuntimeChecks Condition=\"'$(Configuration)'!='Debug'\">Default</BasicRuntimeChecks>" << endl;
   file << "      <InlineFunctionExpansion Condition=\"'$(Configuration)'=='Debug'\">Disabled</InlineFunctionExpansion>" << endl;
-  file << "      <InlineFunctionExpansion Condition=\"'$(Configuration)'=='Release'\">AnySuitable</InlineFunctionExpansion>" << endl;
+  file << "      <InlineFunctionExpansion Condition=\"'$(Configuration)'!='Debug'\">AnySuitable</InlineFunctionExpansion>" << endl;
   file << "      <OmitFramePointers Condition=\"'$(Configuration)'=='Debug'\">false</OmitFramePointers>" << endl;
-  file << "      <OmitFramePointers Condition=\"'$(Configuration)'=='Release'\">true</OmitFramePointers>" << endl;
+  file << "      <OmitFramePointers Condition=\"'$(Configuration)'!='Debug'\">true</OmitFramePointers>" << endl;
   file << "      <Optimization Condition=\"'$(Configuration)'=='Debug'\">Disabled</Optimization>" << endl;
-  file << "      <Optimization Condition=\"'$(Configuration)'=='Release'\">MaxSpeed</Optimization>" << endl;
+  file << "      <Optimization Condition=\"'$(Configuration)'!='Debug'\">MaxSpeed</Optimization>" << endl;
   file << "      <PreprocessorDefinitions>" << defines() << ";%(PreprocessorDefinitions)</PreprocessorDefinitions>" << endl;
   file << "      <PreprocessorDefinitions Condition=\"'$(Configuration)'=='Debug'\">_DEBUG;%(PreprocessorDefinitions)</PreprocessorDefinitions>" << endl;
-  file << "      <PreprocessorDefinitions Condition=\"'$(Configuration)'=='Release'\">NDEBUG;%(PreprocessorDefinitions)</PreprocessorDefinitions>" << endl;
+  file << "      <PreprocessorDefinitions Condition=\"'$(Configuration)'!='Debug'\">NDEBUG;%(PreprocessorDefinitions)</PreprocessorDefinitions>" << endl;
   file << "      <RuntimeLibrary Condition=\"'$(Configuration)'=='Debug'\">" << runtimeLibrary(true) << "</RuntimeLibrary>" << endl;
-  file << "      <RuntimeLibrary Condition=\"'$(Configuration)'=='Release'\">" << runtimeLibrary(false) << "</RuntimeLibrary>" << endl;
+  file << "      <RuntimeLibrary Condition=\"'$(Configuration)'!='Debug'\">" << runtimeLibrary(false) << "</RuntimeLibrary>" << endl;
   if (compiler() == Compiler::CPP)
     file << "      <CompileAs>CompileAsCpp</CompileAs>" << endl;
   if (_config.isMagickProject() && _options.isImageMagick7)
     file << "      <TreatWarningAsError>true</TreatWarningAsError>" << endl;
+  if (wholeProgramOptimization())
+  {
+    file << "      <AdditionalOptions Condition=\"'$(Configuration)'!='Debug'\">/Gw %(AdditionalOptions)</AdditionalOptions>" << endl;
+    file << "      <WholeProgramOptimization Condition=\"'$(Configuration)'!='Debug'\">true</WholeProgramOptimization>" << endl;
+  }
   file << "    </ClCompile>" << endl;
   file << "  </ItemDefinitionGroup>" << endl;
 }
@@ -426,15 +887,62 @@ void Project::writeCompilationConfiguration(wofstream &file) const
 void Project::writeConfiguration(wofstream &file) const
 {
   file << "  <ItemGroup Label=\"ProjectConfigurations\">" << endl;
-  file << "    <ProjectConfiguration Include=\"Debug|" << _options.platform() << "\">" << endl;
-  file << "      <Configuration>Debug</Configuration>" << endl;
-  file << "      <Platform>" << _options.platform() << "</Platform>" << endl;
-  file << "    </ProjectConfiguration>" << endl;
-  file << "    <ProjectConfiguration Include=\"Release|" << _options.platform() << "\">" << endl;
-  file << "      <Configuration>Release</Configuration>" << endl;
-  file << "      <Platform>" << _options.platform() << "</Platform>" << endl;
-  file << "    </ProjectConfiguration>" << endl;
+  for (const auto& configuration : _options.configurations())
+  {
+    file << "    <ProjectConfiguration Include=\"" << configuration << "|" << _options.platform() << "\">" << endl;
+    file << "      <Configuration>" << configuration << "</Configuration>" << endl;
+    file << "      <Platform>" << _options.platform() << "</Platform>" << endl;
+    file << "    </ProjectConfiguration>" << endl;
+  }
+  file << "  </ItemGroup>" << endl;
+}
+
+void Project::writeCopyAliases(wofstream &file) const
+{
+  if (_aliases.empty())
+    return;
+
+  file << "  <ItemGroup>" << endl;
+  for (const auto& alias : _aliases)
+    file << "    <Aliases Include=\"" << alias << "\" />" << endl;
+  file << "  </ItemGroup>" << endl;
+  file << "  <Target Name=\"CopyAliases\" AfterTargets=\"Build\">" << endl;
+  file << "    <Copy SourceFiles=\"@(Aliases->'$(TargetPath)')\" DestinationFiles=\"@(Aliases->'$(OutDir)%(Identity)$(TargetExt)')\" SkipUnchangedFiles=\"true\" UseHardlinksIfPossible=\"true\" />" << endl;
+  file << "  </Target>" << endl;
+}
+
+void Project::writeCopyToVariants(wofstream &file) const
+{
+  // The dependencies are built once, their libraries must also be next to the executables of every variant.
+  if (_options.variants.empty() || !variant().empty() || _options.isStaticBuild || outputDirectory() != L"bin")
+    return;
+
+  file << "  <ItemGroup>" << endl;
+  for (const auto& variant : _options.variants)
+    file << "    <VariantDirectories Include=\"$(SolutionDir)" << _options.variantOptions(variant).artifactsDirectory(L"bin") << "\\\" />" << endl;
   file << "  </ItemGroup>" << endl;
+  file << "  <Target Name=\"CopyToVariants\" AfterTargets=\"Build\">" << endl;
+  file << "    <Copy SourceFiles=\"$(TargetPath)\" DestinationFolder=\"%(VariantDirectories.Identity)\" SkipUnchangedFiles=\"true\" UseHardlinksIfPossible=\"true\" />" << endl;
+  file << "  </Target>" << endl;
+}
+
+void Project::writeCopyImportLibrary(wofstream &file) const
+{
+  if (!useTrackedImportLibrary())
+    return;
+
+  const auto importLibrary=L"$(SolutionDir)" + _options.artifactsDirectory(L"lib") + L"\\" + targetName(true) + L".lib";
+
+  // The linker writes the import library on every link, it is only copied when the exports changed so the dependants do not relink.
+  file << "  <Target Name=\"CopyImportLibrary\" AfterTargets=\"Link\" Condition=\"'$(Configuration)'=='Debug'\">" << endl;
+  file << "    <GetFileHash Files=\"$(IntDir)" << targetName(true) << ".lib\">" << endl;
+  file << "      <Output TaskParameter=\"Hash\" PropertyName=\"NewImportLibraryHash\" />" << endl;
+  file << "    </GetFileHash>" << endl;
+  file << "    <GetFileHash Files=\"" << importLibrary << "\" Condition=\"Exists('" << importLibrary << "')\">" << endl;
+  file << "      <Output TaskParameter=\"Hash\" PropertyName=\"ImportLibraryHash\" />" << endl;
+  file << "    </GetFileHash>" << endl;
+  file << "    <Copy SourceFiles=\"$(IntDir)" << targetName(true) << ".lib\" DestinationFiles=\"" << importLibrary << "\" Condition=\"'$(NewImportLibraryHash)'!='$(ImportLibraryHash)'\" />" << endl;
+  file << "  </Target>" << endl;
 }
 
 void Project::writeCopyIncludes(wofstream &file) const
@@ -442,24 +950,38 @@ void Project::writeCopyIncludes(wofstream &file) const
   if (_config.includeArtifacts().empty())
     return;
 
-  file << "  <Target Name=\"CopyIncludes\" AfterTargets=\"Build\">" << endl;
-  file << "    <RemoveDir Directories=\"$(SolutionDir)Artifacts\\include\\" << name() << "\" Condition=\"Exists('$(SolutionDir)Artifacts\\include\\" << name() << "')\" />" << endl;
+  const auto includeDirectory=L"$(SolutionDir)Artifacts\\include\\" + name() + L"\\";
+
+  file << "  <Target Name=\"CollectIncludes\">" << endl;
   file << "    <ItemGroup>" << endl;
   size_t index=0;
   for (const auto& include : _config.includeArtifacts())
   {
+    const auto destination=include.second.empty() ? includeDirectory : includeDirectory + include.second + L"\\";
     if (endsWith(include.first,L".h"))
-      file << "      <HeaderFiles" << index++ << " Include=\"$(SolutionDir)" << include.first << "\" />" << endl;
+      file << "      <HeaderFiles" << index++ << " Include=\"$(SolutionDir)" << include.first << "\">" << endl;
     else
-      file << "      <HeaderFiles" << index++ << " Include=\"$(SolutionDir)" << include.first << "\\*.h\" />" << endl;
+      file << "      <HeaderFiles" << index++ << " Include=\"$(SolutionDir)" << include.first << "\\*.h\">" << endl;
+    file << "        <Destination>" << destination << "</Destination>" << endl;
+    file << "      </HeaderFiles" << (index - 1) << ">" << endl;
   }
   file << "    </ItemGroup>" << endl;
-   index=0;
+  index=0;
   for (const auto& include : _config.includeArtifacts())
-  {
-    file << "    <Error Condition=\"'@(HeaderFiles" << index << ")' == ''\" Text=\"No header files found in: " << include.first << "\" />" << endl;
-    file << "    <Copy SourceFiles=\"@(HeaderFiles" << index++ << ")\" DestinationFolder=\"$(SolutionDir)Artifacts\\include\\" << name() << "\\" << include.second << "\" SkipUnchangedFiles=\"true\" />" << endl;
-  }
+    file << "    <Error Condition=\"'@(HeaderFiles" << index++ << ")' == ''\" Text=\"No header files found in: " << include.first << "\" />" << endl;
+  file << "    <ItemGroup>" << endl;
+  for (index=0; index < _config.includeArtifacts().size(); index++)
+    file << "      <IncludeArtifacts Include=\"@(HeaderFiles" << index << ")\" />" << endl;
+  file << "    </ItemGroup>" << endl;
+  file << "  </Target>" << endl;
+  file << "  <Target Name=\"CopyIncludes\" AfterTargets=\"Build\" DependsOnTargets=\"CollectIncludes\" Inputs=\"@(IncludeArtifacts)\" Outputs=\"@(IncludeArtifacts->'%(Destination)%(Filename)%(Extension)')\">" << endl;
+  file << "    <Copy SourceFiles=\"@(IncludeArtifacts)\" DestinationFiles=\"@(IncludeArtifacts->'%(Destination)%(Filename)%(Extension)')\" SkipUnchangedFiles=\"true\" />" << endl;
+  file << "  </Target>" << endl;
+  file << "  <Target Name=\"RemoveStaleIncludes\" AfterTargets=\"CopyIncludes\" DependsOnTargets=\"CollectIncludes\">" << endl;
+  file << "    <ItemGroup>" << endl;
+  file << "      <StaleIncludes Include=\"" << includeDirectory << "**\\*.h\" Exclude=\"@(IncludeArtifacts->'%(Destination)%(Filename)%(Extension)')\" />" << endl;
+  file << "    </ItemGroup>" << endl;
+  file << "    <Delete Files=\"@(StaleIncludes)\" />" << endl;
   file << "  </Target>" << endl;
 }
 
@@ -473,22 +995,37 @@ void Project::writeFiles(wofstream &file) const
 
     if (endsWith(fileName,L".h"))
       file << "    <ClInclude Include=\"$(SolutionDir)" << _config.directory() << fileName << "\" />" << endl;
+    else if (endsWith(fileName,L".S"))
+    {
+      // GNU syntax assembly is preprocessed and assembled by clang-cl because armasm64 only accepts armasm syntax.
+      const auto objectFileName=fileNameCount[objectName]++ == 0 ? wstring(L"$(IntDir)%(Filename).obj") : L"$(IntDir)%(Filename)." + to_wstring(fileNameCount[objectName]) + L".obj";
+      file << "    <CustomBuild Include=\"$(SolutionDir)" << _config.directory() << fileName << "\">" << endl;
+      file << "      <Command>\"$(LLVMInstallDir)\\bin\\clang-cl.exe\"" << armAssemblerOptions() << " \"%(FullPath)\" /Fo\"" << objectFileName << "\"</Command>" << endl;
+      file << "      <Outputs>" << objectFileName << ";%(Outputs)</Outputs>" << endl;
+      file << "    </CustomBuild>" << endl;
+    }
     else if (endsWith(fileName,L".asm"))
     {
       if (_config.useNasm())
       {
         file << "    <CustomBuild Include=\"$(SolutionDir)" << _config.directory() << fileName << "\">" << endl;
         file << "      <Command>$(SolutionDir)Configure\\Tools\\nasm.exe" << nasmOptions() << "</Command>" << endl;
+        const auto dependencies=assemblyDependencies(fileName);
+        if (!dependencies.empty())
+          file << "      <AdditionalInputs>" << dependencies << "%(AdditionalInputs)</AdditionalInputs>" << endl;
         if (fileNameCount[objectName]++ == 0)
           file << "      <Outputs>$(IntDir)%(Filename).obj;%(Outputs)</Outputs>" << endl;
         else
           file << "      <Outputs>$(IntDir)%(Filename)." << fileNameCount[objectName] << ".obj;%(Outputs)</Outputs>" << endl;
         file << "    </CustomBuild>" << endl;
       }
-      else if (_options.architecture == Architecture::Arm64)
+      else if (_options.isArm64())
       {
         file << "    <CustomBuild Include=\"$(SolutionDir)" << _config.directory() << fileName << "\">" << endl;
-        file << "      <Command>armasm64 \"%(FullPath)\" -o \"$(IntDir)%(Filename).obj\"</Command>" << endl;
+        file << "      <Command>armasm64" << (_options.architecture == Architecture::Arm64EC ? " -machine ARM64EC" : "") << " \"%(FullPath)\" -o \"$(IntDir)%(Filename).obj\"</Command>" << endl;
+        const auto dependencies=assemblyDependencies(fileName);
+        if (!dependencies.empty())
+          file << "      <AdditionalInputs>" << dependencies << "%(AdditionalInputs)</AdditionalInputs>" << endl;
         if (fileNameCount[objectName]++ == 0)
           file << "      <Outputs>$(IntDir)%(Filename).obj;%(Outputs)</Outputs>" << endl;
         else
@@ -506,12 +1043,21 @@ void Project::writeFiles(wofstream &file) const
     }
     else
     {
-      if (fileNameCount[objectName]++ == 0)
+      const auto optimization=fileOptimization(fileName);
+      const auto options=fileOptions(fileName);
+      const auto count=++fileNameCount[objectName];
+
+      if (count == 1 && optimization.empty() && options.empty())
         file << "    <ClCompile Include=\"$(SolutionDir)" << _config.directory() << fileName << "\" />" << endl;
       else
       {
         file << "    <ClCompile Include=\"$(SolutionDir)" << _config.directory() << fileName << "\">" << endl;
-        file << "      <ObjectFileName>$(IntDir)" << objectName << L"." << fileNameCount[objectName] << ".obj</ObjectFileName>" << endl;
+        if (count > 1)
+          file << "      <ObjectFileName>$(IntDir)" << objectName << L"." << count << ".obj</ObjectFileName>" << endl;
+        if (!optimization.empty())
+          file << "      <Optimization Condition=\"'$(Configuration)'!='Debug'\">" << optimization << "</Optimization>" << endl;
+        if (!options.empty())
+          file << "      <AdditionalOptions>%(AdditionalOptions)" << options << "</AdditionalOptions>" << endl;
         file << "    </ClCompile>" << endl;
       }
     }
@@ -537,11 +1083,15 @@ void Project::writeFilters() const
 
   for (const auto& fileName : _files)
   {
-    size_t slashIndex=fileName.find_last_of(L"\\");
+    auto filterName=fileName;
+    while (startsWith(filterName,L"..\\"))
+      filterName=filterName.substr(3);
+
+    size_t slashIndex=filterName.find_last_of(L"\\");
     if (slashIndex == wstring::npos)
       continue;
 
-    const auto directory=fileName.substr(0,slashIndex);
+    const auto directory=filterName.substr(0,slashIndex);
     directories.insert(directory);
     auto parentDirectory=directory;
     while (slashIndex != wstring::npos)
@@ -557,6 +1107,10 @@ void Project::writeFilters() const
     {
       tag = L"ClInclude";
     }
+    else if (endsWith(fileName, L".S"))
+    {
+      tag = L"CustomBuild";
+    }
     else if (endsWith(fileName, L".asm"))
     {
       if (_config.useNasm())
@@ -586,6 +1140,10 @@ void Project::writeLibProperties(wofstream& file) const
   file << "  <ItemDefinitionGroup>" << endl;
   file << "    <Lib>" << endl;
   file << "      <TreatLibWarningAsErrors>true</TreatLibWarningAsErrors>" << endl;
+  if (_options.cacheable)
+    file << "      <AdditionalOptions>/Brepro %(AdditionalOptions)</AdditionalOptions>" << endl;
+  if (wholeProgramOptimization())
+    file << "      <LinkTimeCodeGeneration Condition=\"'$(Configuration)'!='Debug'\">true</LinkTimeCodeGeneration>" << endl;
   file << "    </Lib>" << endl;
   file << "  </ItemDefinitionGroup>" << endl;
 }
@@ -598,7 +1156,7 @@ void Project::writeLicense() const
   License::write(_options,_config,name());
 }
 
-void Project::writeLinkProperties(wofstream& file) const
+void Project::writeLinkProperties(wofstream& file,const vector<Project> &allProjects) const
 {
   wstring preBuildLibs;
 
@@ -610,12 +1168,51 @@ void Project::writeLinkProperties(wofstream& file) const
 
   file << "  <ItemDefinitionGroup>" << endl;
   file << "    <Link>" << endl;
-  file << "      <AdditionalLibraryDirectories>$(SolutionDir)Artifacts\\lib;%(AdditionalLibraryDirectories)</AdditionalLibraryDirectories>" << endl;
+  file << "      <AdditionalLibraryDirectories>" << libraryDirectories() << "%(AdditionalLibraryDirectories)</AdditionalLibraryDirectories>" << endl;
+  if (useClang() && _options.useOpenMP)
+    file << "      <AdditionalLibraryDirectories>$(LLVMInstallDir)\\lib;%(AdditionalLibraryDirectories)</AdditionalLibraryDirectories>" << endl;
   file << "      <TreatLinkerWarningAsErrors>true</TreatLinkerWarningAsErrors>" << endl;
-  file << "      <AdditionalDependencies Condition=\"'$(Configuration)'=='Debug'\">" << additionalDependencies(true) << "%(AdditionalDependencies)</AdditionalDependencies>" << endl;
-  file << "      <AdditionalDependencies Condition=\"'$(Configuration)'=='Release'\">" << preBuildLibs << additionalDependencies(false) << "%(AdditionalDependencies)</AdditionalDependencies>" << endl;
-  file << "      <ImportLibrary Condition=\"'$(Configuration)'=='Debug'\">$(SolutionDir)Artifacts\\lib\\" << targetName(true) <<".lib</ImportLibrary>" << endl;
-  file << "      <ImportLibrary Condition=\"'$(Configuration)'=='Release'\">$(SolutionDir)Artifacts\\lib\\" << targetName(false) <<".lib</ImportLibrary>" << endl;
+  if (_options.developerLink)
+    file << "      <GenerateDebugInformation Condition=\"'$(Configuration)'=='Debug'\">DebugFastLink</GenerateDebugInformation>" << endl;
+  // The import library must only change when the exports change, this needs a link without timestamps.
+  if (useTrackedImportLibrary() && !_options.cacheable)
+    file << "      <AdditionalOptions Condition=\"'$(Configuration)'=='Debug'\">/Brepro %(AdditionalOptions)</AdditionalOptions>" << endl;
+  if (_options.cacheable)
+    file << "      <AdditionalOptions>/Brepro /PDBALTPATH:%_PDB% %(AdditionalOptions)</AdditionalOptions>" << endl;
+  file << "      <AdditionalDependencies Condition=\"'$(Configuration)'=='Debug'\">" << additionalDependencies(true,allProjects) << "%(AdditionalDependencies)</AdditionalDependencies>" << endl;
+  file << "      <AdditionalDependencies Condition=\"'$(Configuration)'!='Debug'\">" << preBuildLibs << additionalDependencies(false,allProjects) << "%(AdditionalDependencies)</AdditionalDependencies>" << endl;
+  if (_options.delayLoad && !_options.isStaticBuild)
+  {
+    const auto debugLibraries=delayLoadLibraries(true,allProjects);
+    const auto releaseLibraries=delayLoadLibraries(false,allProjects);
+    if (!releaseLibraries.empty())
+    {
+      file << "      <DelayLoadDLLs Condition=\"'$(Configuration)'=='Debug'\">" << debugLibraries << "%(DelayLoadDLLs)</DelayLoadDLLs>" << endl;
+      file << "      <DelayLoadDLLs Condition=\"'$(Configuration)'!='Debug'\">" << releaseLibraries << "%(DelayLoadDLLs)</DelayLoadDLLs>" << endl;
+    }
+  }
+  if (useTrackedImportLibrary())
+    file << "      <ImportLibrary Condition=\"'$(Configuration)'=='Debug'\">$(IntDir)" << targetName(true) <<".lib</ImportLibrary>" << endl;
+  else
+    file << "      <ImportLibrary Condition=\"'$(Configuration)'=='Debug'\">$(SolutionDir)" << _options.artifactsDirectory(L"lib") << "\\" << targetName(true) <<".lib</ImportLibrary>" << endl;
+  file << "      <ImportLibrary Condition=\"'$(Configuration)'!='Debug'\">$(SolutionDir)" << _options.artifactsDirectory(L"lib") << profileDirectory() << "\\" << targetName(false) <<".lib</ImportLibrary>" << endl;
+  if (_options.ltcg)
+  {
+    // Applications of a static build link the Magick libraries that were compiled with /GL.
+    if (wholeProgramOptimization() || (_options.isStaticBuild && isApplication()))
+    {
+      file << "      <LinkTimeCodeGeneration Condition=\"'$(Configuration)'!='Debug'\">" << (_options.ltcgIncremental ? "UseFastLinkTimeCodeGeneration" : "UseLinkTimeCodeGeneration") << "</LinkTimeCodeGeneration>" << endl;
+      // lld-link has no profile guided optimization, projects of the ClangCL toolset keep the Release settings in the PG configurations.
+      if (_options.pgo && !useClang())
+      {
+        file << "      <LinkTimeCodeGeneration Condition=\"'$(Configuration)'=='PGInstrument'\">PGInstrument</LinkTimeCodeGeneration>" << endl;
+        file << "      <LinkTimeCodeGeneration Condition=\"'$(Configuration)'=='PGOptimize'\">PGOptimization</LinkTimeCodeGeneration>" << endl;
+        file << "      <ProfileGuidedDatabase Condition=\"'$(Configuration)'!='Debug'\">$(SolutionDir)" << _options.artifactsDirectory(L"pgo") << "\\$(TargetName).pgd</ProfileGuidedDatabase>" << endl;
+      }
+    }
+    file << "      <EnableCOMDATFolding Condition=\"'$(Configuration)'!='Debug'\">true</EnableCOMDATFolding>" << endl;
+    file << "      <OptimizeReferences Condition=\"'$(Configuration)'!='Debug'\">true</OptimizeReferences>" << endl;
+  }
   if (_config.useUnicode())
     file << "      <EntryPointSymbol>wWinMainCRTStartup</EntryPointSymbol>" << endl;
   if (!_config.moduleDefinitionFile().empty())
@@ -626,27 +1223,30 @@ void Project::writeLinkProperties(wofstream& file) const
 
 void Project::writeMagickBaseconfigDefine() const
 {
-  if (_config.magickBaseconfigDefine().empty())
-    return;
-
-  const auto targetDirectory=_options.rootDirectory + L"Artifacts\\config\\";
-  filesystem::create_directories(targetDirectory);
-
-  const auto configFileName=targetDirectory + name() + L".h";
-  wofstream configFile(configFileName);
-  if (!configFile)
-    throwException(L"Failed to open license file: " + configFileName);
-
-  configFile << _config.magickBaseconfigDefine();
+  MagickBaseConfig::writeDefine(_options,_config,name());
 }
 
 void Project::writeOutputProperties(wofstream &file) const
 {
   file << "  <PropertyGroup>" << endl;
-  file << "    <LinkIncremental>false</LinkIncremental>" << endl;
-  file << "    <OutDir>$(SolutionDir)Artifacts\\" << outputDirectory() << "\\</OutDir>" << endl;
+  if (_options.developerLink)
+  {
+    file << "    <LinkIncremental Condition=\"'$(Configuration)'=='Debug'\">true</LinkIncremental>" << endl;
+    file << "    <LinkIncremental Condition=\"'$(Configuration)'!='Debug'\">false</LinkIncremental>" << endl;
+  }
+  else
+    file << "    <LinkIncremental>false</LinkIncremental>" << endl;
+  // The GNU syntax assembly is built with clang-cl, the MSVC toolset only knows where it is when the LLVM tools are configured.
+  if (any_of(_files.begin(),_files.end(),[](const auto &fileName) { return(endsWith(fileName,L".S")); }))
+    file << "    <LLVMInstallDir Condition=\"'$(LLVMInstallDir)'==''\">$(VsInstallRoot)\\VC\\Tools\\Llvm</LLVMInstallDir>" << endl;
+  if (_options.pgo)
+  {
+    // The profile guided optimization configurations write to their own directory so they do not replace the Release output.
+    file << "    <ProfileDirectory Condition=\"'$(Configuration)'=='PGInstrument' Or '$(Configuration)'=='PGOptimize'\">\\$(Configuration)</ProfileDirectory>" << endl;
+  }
+  file << "    <OutDir>$(SolutionDir)" << _options.artifactsDirectory(outputDirectory()) << profileDirectory() << "\\</OutDir>" << endl;
   file << "    <TargetName Condition=\"'$(Configuration)'=='Debug'\">" << targetName(true) << "</TargetName>" << endl;
-  file << "    <TargetName Condition=\"'$(Configuration)'=='Release'\">" << targetName(false) << "</TargetName>" << endl;
+  file << "    <TargetName Condition=\"'$(Configuration)'!='Debug'\">" << targetName(false) << "</TargetName>" << endl;
   if (_options.visualStudioVersion >= VisualStudioVersion::VS2019)
     file << "    <UseDebugLibraries Condition=\"'$(Configuration)'=='Debug'\">true</UseDebugLibraries>" << endl;
   file << "  </PropertyGroup>" << endl;
@@ -664,6 +1264,8 @@ void Project::writeProperties(wofstream &file) const
   file << "    <CharacterSet>" << characterSet() << "</CharacterSet>" << endl;
   file << "    <ConfigurationType>" << configurationType() << "</ConfigurationType>" << endl;
   file << "    <PlatformToolset>" << platformToolset() << "</PlatformToolset>" << endl;
+  if (useClang())
+    file << "    <UseLldLink>true</UseLldLink>" << endl;
   file << "    <UseOfMfc>false</UseOfMfc>" << endl;
   file << "  </PropertyGroup>" << endl;
   file << "  <Import Project=\"$(VCTargetsPath)\\Microsoft.Cpp.props\" />" << endl;
@@ -684,6 +1286,9 @@ void Project::writeReference(wofstream &file,const Project &project) const
     file << "    <ProjectReference Include=\"$(SolutionDir)" << project.fileName() << "\">" << endl;
     file << "      <Project>{" << project.guid() << "}</Project>" << endl;
     file << "      <Name>" << project.fullName() << "</Name>" << endl;
+    // The copy of the import library is linked through the additional dependencies.
+    if (project.useTrackedImportLibrary())
+      file << "      <LinkLibraryDependencies>false</LinkLibraryDependencies>" << endl;
     file << "    </ProjectReference>" << endl;
 }
 
@@ -693,34 +1298,8 @@ void Project::writeReferences(wofstream &file,const vector<Project> &allProjects
     return;
 
   file << "  <ItemGroup>" << endl;
-
-  for (const auto& reference : _config.references())
-  {
-    auto project = find_if(allProjects.begin(), allProjects.end(),[&reference](const Project& p) { return(p.isLibrary() && p.name() == reference); });
-    if (project == allProjects.end())
-      continue;
-
-    writeReference(file,project[0]);
-  }
-
-  for (const auto& reference : _config.coderReferences())
-  {
-    auto project = find_if(allProjects.begin(), allProjects.end(),[&reference](const Project& p) { return(p.type() == ProjectType::Coder && p.name() == reference); });
-    if (project == allProjects.end())
-      continue;
-
-    writeReference(file,project[0]);
-  }
-
-  if (isApplication())
-  {
-    for (const auto& project : allProjects)
-    {
-      if (project.type() == ProjectType::Coder || project.type() == ProjectType::Filter)
-        writeReference(file,project);
-    }
-  }
-
+  for (const auto& project : referencedProjects(allProjects))
+    writeReference(file,*project);
   file << "  </ItemGroup>" << endl;
 }
 
@@ -26,28 +26,62 @@
 class Project
 {
 public:
+  const vector<wstring>& aliases() const { return(_aliases); };
+
+  const set<wstring>& coderReferences() const { return(_config.coderReferences()); };
+
+  const set<wstring>& coders() const { return(_coders); };
+
+  const wstring configurationType() const;
+
+  const wstring defines() const;
+
   const wstring directory() const { return(_config.directory()); };
 
+  const set<wstring>& files() const { return(_files); };
+
   const wstring fileName() const { return(_options.projectsDirectory() + fullName() + L"\\" + fullName() + L".vcxproj"); }
 
-  const wstring fullName() const { return(prefix() + L"_" + name()); }
+  const wstring fullName() const;
 
   const wstring guid() const { return(createGuid(fullName())); };
 
+  const wstring includeDirectories() const;
+
   const bool isLibrary() const { return(_config.isLibrary()); };
 
+  const bool isMagickProject() const { return(_config.isMagickProject()); };
+
   const wstring name() const { return(_config.name()); };
 
+  const wstring outputDirectory() const;
+
+  const wstring outputFileName(bool debug) const;
+
+  const wstring targetName(bool debug) const;
+
   const ProjectType type() const { return(_config.type()); };
 
+  const wstring variant() const { return(_options.variant); };
+
+  void addCoder(const Project &coderProject);
+
   void copyConfigInfo(const Config& config);
 
   static Project create(const Config &config,const Options &options);
 
   const set<wstring>& references() const { return(_config.references()); };
 
+  const vector<const Project*> referencedProjects(const vector<Project> &allProjects) const;
+
+  void removeCoderReference(const wstring& name);
+
   void rename(const wstring& name);
 
+  void setAliases(const vector<wstring> aliases);
+
+  void setCoders(const set<wstring> coders);
+
   void setFiles(const vector<wstring> files);
 
   vector<Project> splitToFiles(const vector<wstring> additionalFiles = {}) const;
@@ -63,33 +97,57 @@ public:
 private:
   Project(const Config &config,const Options &options);
 
+  const wstring armAssemblerOptions() const;
+
+  const wstring assemblyDependencies(const wstring &sourceName) const;
+
+  void assemblyDependencies(const filesystem::path &sourceFile,const wstring &directive,const vector<filesystem::path> &directories,set<wstring> &dependencies) const;
+
   const wstring characterSet() const;
 
+  const wstring compilerOptions() const;
+
   const Compiler compiler() const;
 
-  const wstring configurationType() const;
+  const wstring enhancedInstructionSet() const;
 
-  const wstring defines() const;
+  const wstring fileOptimization(const wstring &fileName) const;
 
-  const bool hasAsmfiles() const;
+  const wstring fileOptions(const wstring &fileName) const;
 
-  const wstring includeDirectories() const;
+  const bool hasAsmfiles() const;
 
   const bool isApplication() const;
 
+  const bool isArm64Assembly(const wstring &fileName) const;
+
+  const bool isLazyCoderRegistration() const;
+
+  const bool isSameVariant(const Project &project) const;
+
+  const wstring libraryDirectories() const;
+
   const wstring nasmOptions() const;
 
   const wstring openMPSupport() const;
 
-  const wstring outputDirectory() const;
-
   const wstring platformToolset() const;
 
   const wstring prefix() const;
 
+  const wstring profileDirectory() const;
+
+  const bool useClang() const;
+
+  const bool useTrackedImportLibrary() const;
+
   const wstring warningLevel() const;
 
-  const wstring additionalDependencies(bool debug) const;
+  const bool wholeProgramOptimization() const;
+
+  const wstring additionalDependencies(bool debug,const vector<Project> &allProjects) const;
+
+  const wstring delayLoadLibraries(bool debug,const vector<Project> &allProjects) const;
 
   bool isExcluded(const wstring fileName,set<wstring> &excludes,multiset<wstring> &foundExcludes) const;
 
@@ -97,21 +155,29 @@ private:
 
   void loadFiles(const wstring directory,set<wstring> &excludes,multiset<wstring> &foundExcludes);
 
+  const set<wstring> prebuiltReferences(const vector<Project> &allProjects) const;
+
   const wstring runtimeLibrary(bool debug) const;
 
-  const wstring targetName(bool debug) const;
+  const set<wstring> sourceFiles() const;
 
   void writeCompilationConfiguration(wofstream &file) const;
 
   void writeConfiguration(wofstream &file) const;
 
+  void writeCopyAliases(wofstream &file) const;
+
+  void writeCopyImportLibrary(wofstream &file) const;
+
   void writeCopyIncludes(wofstream &file) const;
+
+  void writeCopyToVariants(wofstream &file) const;
   
   void writeFiles(wofstream &file) const;
 
   void writeLibProperties(wofstream& file) const;
 
-  void writeLinkProperties(wofstream& file) const;
+  void writeLinkProperties(wofstream& file,const vector<Project> &allProjects) const;
 
   void writeOutputProperties(wofstream &file) const;
 
@@ -125,6 +191,8 @@ private:
 
   void writeTargetsImports(wofstream& file,bool includeMasm) const;
 
+  vector<wstring> _aliases;
+  set<wstring> _coders;
   Config _config;
   set<wstring> _files;
   const Options _options;
@@ -0,0 +1,183 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#include "ProjectGraph.h"
+
+ProjectGraph::ProjectGraph(const vector<Project> &projects)
+  : _projects(&projects)
+{
+  _dependencies.resize(projects.size());
+  for (size_t i=0; i < projects.size(); i++)
+  {
+    for (const auto& reference : projects[i].referencedProjects(projects))
+      _dependencies[i].push_back(reference - &projects[0]);
+  }
+}
+
+void ProjectGraph::checkCircularReferences() const
+{
+  vector<int> state(size(),0);
+
+  for (size_t i=0; i < size(); i++)
+    checkCircularReferences(i,state);
+}
+
+void ProjectGraph::checkCircularReferences(const size_t index,vector<int> &state) const
+{
+  if (state[index] == 2)
+    return;
+
+  if (state[index] == 1)
+    throwException(L"Circular reference detected in project " + (*_projects)[index].fullName());
+
+  state[index]=1;
+  for (const auto& dependency : _dependencies[index])
+    checkCircularReferences(dependency,state);
+  state[index]=2;
+}
+
+const vector<bool> ProjectGraph::closure(const vector<size_t> &roots) const
+{
+  vector<bool> reachable(size(),false);
+  vector<size_t> pending(roots);
+
+  while (!pending.empty())
+  {
+    const auto index=pending.back();
+    pending.pop_back();
+    if (reachable[index])
+      continue;
+
+    reachable[index]=true;
+    for (const auto& dependency : _dependencies[index])
+      pending.push_back(dependency);
+  }
+
+  return(reachable);
+}
+
+const vector<size_t> ProjectGraph::criticalPath(const vector<double> &costs) const
+{
+  vector<size_t>
+    path;
+
+  const auto times=finishTimes(costs);
+  if (times.empty())
+    return(path);
+
+  auto index=(size_t) (max_element(times.begin(),times.end()) - times.begin());
+  while (true)
+  {
+    path.insert(path.begin(),index);
+
+    const auto& dependencies=_dependencies[index];
+    if (dependencies.empty())
+      break;
+
+    index=*max_element(dependencies.begin(),dependencies.end(),[&times](size_t a,size_t b) { return(times[a] < times[b]); });
+  }
+
+  return(path);
+}
+
+const vector<double> ProjectGraph::finishTimes(const vector<double> &costs) const
+{
+  vector<double> times(size(),0.0);
+  vector<int> state(size(),0);
+
+  for (size_t i=0; i < size(); i++)
+    visit(i,costs,times,state);
+
+  return(times);
+}
+
+const vector<size_t> ProjectGraph::find(const wstring &name) const
+{
+  vector<size_t>
+    indices;
+
+  // A full name selects a single variant, a plain name selects all of them.
+  for (size_t i=0; i < size(); i++)
+  {
+    if (_wcsicmp((*_projects)[i].fullName().c_str(),name.c_str()) == 0)
+      return(vector<size_t> { i });
+  }
+
+  for (size_t i=0; i < size(); i++)
+  {
+    if (_wcsicmp((*_projects)[i].name().c_str(),name.c_str()) == 0)
+      indices.push_back(i);
+  }
+
+  return(indices);
+}
+
+const vector<double> ProjectGraph::remainingTimes(const vector<double> &costs) const
+{
+  vector<vector<size_t>> dependants(size());
+  for (size_t i=0; i < size(); i++)
+  {
+    for (const auto& dependency : _dependencies[i])
+      dependants[dependency].push_back(i);
+  }
+
+  // The remaining time of a project is its own cost plus the longest chain of
+  // work that cannot start before it has finished.
+  vector<double> times(size(),0.0);
+  vector<int> state(size(),0);
+  function<void(size_t)> visitDependants=[&](size_t index)
+  {
+    if (state[index] == 2)
+      return;
+
+    state[index]=2;
+    double remaining=0.0;
+    for (const auto& dependant : dependants[index])
+    {
+      visitDependants(dependant);
+      remaining=max(remaining,times[dependant]);
+    }
+    times[index]=costs[index] + remaining;
+  };
+
+  checkCircularReferences();
+  for (size_t i=0; i < size(); i++)
+    visitDependants(i);
+
+  return(times);
+}
+
+void ProjectGraph::visit(const size_t index,const vector<double> &costs,vector<double> &finishTimes,vector<int> &state) const
+{
+  if (state[index] == 2)
+    return;
+
+  if (state[index] == 1)
+    throwException(L"Circular reference detected in project " + (*_projects)[index].fullName());
+
+  state[index]=1;
+  double start=0.0;
+  for (const auto& dependency : _dependencies[index])
+  {
+    visit(dependency,costs,finishTimes,state);
+    start=max(start,finishTimes[dependency]);
+  }
+  finishTimes[index]=start + costs[index];
+  state[index]=2;
+}
@@ -0,0 +1,53 @@
+/*
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+%                                                                             %
+%  Copyright @ 1999 ImageMagick Studio LLC, a non-profit organization         %
+%  dedicated to making software imaging solutions freely available.           %
+%                                                                             %
+%  You may not use this file except in compliance with the License.  You may  %
+%  obtain a copy of the License at                                            %
+%                                                                             %
+%    http://www.imagemagick.org/script/license.php                            %
+%                                                                             %
+%  Unless required by applicable law or agreed to in writing, software        %
+%  distributed under the License is distributed on an "AS IS" BASIS,          %
+%  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.   %
+%  See the License for the specific language governing permissions and        %
+%  limitations under the License.                                             %
+%                                                                             %
+%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+*/
+#pragma once
+#include "stdafx.h"
+
+#include "Project.h"
+
+class ProjectGraph
+{
+public:
+  ProjectGraph(const vector<Project> &projects);
+
+  const vector<size_t>& dependencies(const size_t index) const { return(_dependencies[index]); }
+
+  const size_t size() const { return(_projects->size()); }
+
+  void checkCircularReferences() const;
+
+  const vector<bool> closure(const vector<size_t> &roots) const;
+
+  const vector<size_t> criticalPath(const vector<double> &costs) const;
+
+  const vector<double> finishTimes(const vector<double> &costs) const;
+
+  const vector<size_t> find(const wstring &name) const;
+
+  const vector<double> remainingTimes(const vector<double> &costs) const;
+
+private:
+  void checkCircularReferences(const size_t index,vector<int> &state) const;
+
+  void visit(const size_t index,const vector<double> &costs,vector<double> &finishTimes,vector<int> &state) const;
+
+  vector<vector<size_t>> _dependencies;
+  const vector<Project> *_projects;
+};
@@ -18,29 +18,27 @@
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 */ 
 #include "Projects.h"
+#include "CoderFormats.h"
+#include "ProjectGraph.h"
 
 vector<Project> Projects::create(const Options &options,vector<Config> &configs)
 {
   vector<Project>
     projects;
 
-  for (auto& config : configs)
-  {
-    if (config.type() == ProjectType::Coder || 
-        config.type() == ProjectType::Demo ||
-        config.type() == ProjectType::Filter || 
-        config.type() == ProjectType::Fuzz ||
-        config.name() == L"utilities")
-      continue;
+  if (!options.coreCoders.empty() && options.isStaticBuild)
+    throwException(L"The core coders are only supported for dynamic builds");
 
-    projects.push_back(Project::create(config,options));
-  }
+  if (options.lazyCoders && !options.isStaticBuild)
+    throwException(L"The lazy coder registration is only supported for static builds");
 
-  createCoderProjects(options,configs,projects);
-  createDemoProjects(options,configs,projects);
-  createFilterProjects(options,configs,projects);
-  createFuzzProjects(options,configs,projects);
-  createUtilitiesProjects(options,configs,projects);
+  if (options.variants.empty())
+    createProjects(options,configs,projects);
+  else
+    createVariantProjects(options,configs,projects);
+
+  if (!options.formats.empty())
+    removeUnreferencedDependencies(projects);
 
   return(projects);
 }
@@ -56,30 +54,152 @@ void Projects::createCoderProjects(const Options &options,vector<Config> &config
     allNames.insert(project.name());
 
   auto codersProject=Project::create(*codersConfig,options);
+
+  const auto formatCoders=formatCoderNames(options,configs,codersProject);
+  if (!formatCoders.empty())
+  {
+    vector<wstring> files;
+    for (const auto& file : codersProject.files())
+    {
+      if (!endsWith(file,L".c") || formatCoders.count(filesystem::path(file).stem().wstring()) > 0)
+        files.push_back(file);
+    }
+    codersProject.setFiles(files);
+  }
   
   if (options.isStaticBuild)
   {
     for (const auto& config : configs)
     {
-      if (config.type() == ProjectType::Coder && config.name() != L"coders")
+      if (config.type() == ProjectType::Coder && config.name() != L"coders" && (formatCoders.empty() || formatCoders.count(config.name()) > 0))
         codersProject.copyConfigInfo(config);
     }
 
+    // MagickCore registers the coders of a static build and needs a list without the removed coders.
+    if (!formatCoders.empty())
+    {
+      auto magickCoreProject=find_if(projects.begin(),projects.end(),[&](const auto &project) { return (project.name() == options.magickCoreName() && project.variant() == options.variant); });
+      if (magickCoreProject == projects.end())
+        throwException(L"Unable to find the " + options.magickCoreName() + L" project for the selected formats");
+
+      magickCoreProject->setCoders(formatCoders);
+    }
+
     projects.push_back(codersProject);
   }
   else
   {
-    for (auto& coderProject : codersProject.splitToFiles())
+    auto coderProjects=codersProject.splitToFiles();
+    for (auto& coderProject : coderProjects)
     {
       auto coderConfig=find_if(configs.begin(),configs.end(),[&](const auto &config) { return (config.type() == ProjectType::Coder && config.name() == coderProject.name()); });
       if (coderConfig != configs.end())
         coderProject.copyConfigInfo(coderConfig[0]);
+    }
+
+    const auto coreCoders=coreCoderNames(options,coderProjects);
+    if (!coreCoders.empty())
+    {
+      auto magickCoreProject=find_if(projects.begin(),projects.end(),[&](const auto &project) { return (project.name() == options.magickCoreName() && project.variant() == options.variant); });
+      if (magickCoreProject == projects.end())
+        throwException(L"Unable to find the " + options.magickCoreName() + L" project for the core coders");
+
+      for (const auto& coderProject : coderProjects)
+      {
+        if (coreCoders.find(coderProject.name()) != coreCoders.end())
+          magickCoreProject->addCoder(coderProject);
+      }
+    }
+
+    for (auto& coderProject : coderProjects)
+    {
+      if (coreCoders.find(coderProject.name()) != coreCoders.end())
+        continue;
+
+      // The core coders are part of MagickCore that is already referenced.
+      for (const auto& coreCoder : coreCoders)
+        coderProject.removeCoderReference(coreCoder);
 
       projects.push_back(coderProject);
     }
   }
 }
 
+set<wstring> Projects::formatCoderNames(const Options &options,const vector<Config> &configs,const Project &codersProject)
+{
+  set<wstring>
+    names;
+
+  vector<wstring>
+    pending;
+
+  if (options.formats.empty())
+    return(names);
+
+  const auto coderFormats=CoderFormats::load(options,{ codersProject });
+  for (const auto& format : options.formats)
+  {
+    auto found=false;
+    for (const auto& coder : coderFormats)
+    {
+      if (_wcsicmp(coder.first.c_str(),format.c_str()) == 0 || any_of(coder.second.begin(),coder.second.end(),[&](const auto &name) { return(_wcsicmp(name.c_str(),format.c_str()) == 0); }))
+      {
+        pending.push_back(coder.first);
+        found=true;
+      }
+    }
+
+    if (!found)
+      throwException(L"Unknown format: " + format);
+  }
+
+  while (!pending.empty())
+  {
+    const auto name=pending.back();
+    pending.pop_back();
+
+    if (!names.insert(name).second)
+      continue;
+
+    auto coderConfig=find_if(configs.begin(),configs.end(),[&](const auto &config) { return (config.type() == ProjectType::Coder && config.name() == name); });
+    if (coderConfig == configs.end())
+      continue;
+
+    for (const auto& reference : coderConfig->coderReferences())
+      pending.push_back(reference);
+  }
+
+  return(names);
+}
+
+set<wstring> Projects::coreCoderNames(const Options &options,const vector<Project> &coderProjects)
+{
+  set<wstring>
+    names;
+
+  vector<wstring>
+    pending(options.coreCoders);
+
+  // A core coder cannot reference a coder module because that module links with MagickCore.
+  while (!pending.empty())
+  {
+    const auto name=pending.back();
+    pending.pop_back();
+
+    auto coderProject=find_if(coderProjects.begin(),coderProjects.end(),[&](const auto &project) { return (_wcsicmp(project.name().c_str(),name.c_str()) == 0); });
+    if (coderProject == coderProjects.end())
+      throwException(L"Unknown core coder: " + name);
+
+    if (!names.insert(coderProject->name()).second)
+      continue;
+
+    for (const auto& reference : coderProject->coderReferences())
+      pending.push_back(reference);
+  }
+
+  return(names);
+}
+
 void Projects::createDemoProjects(const Options &options,vector<Config> &configs,vector<Project> &projects)
 {
   auto demoConfig=find_if(configs.begin(),configs.end(),[&](const auto &config) { return (config.type() == ProjectType::Demo); });
@@ -121,6 +241,27 @@ void Projects::createFuzzProjects(const Options &options,vector<Config> &configs
     projects.push_back(project);
 }
 
+void Projects::createProjects(const Options &options,vector<Config> &configs,vector<Project> &projects)
+{
+  for (auto& config : configs)
+  {
+    if (config.type() == ProjectType::Coder || 
+        config.type() == ProjectType::Demo ||
+        config.type() == ProjectType::Filter || 
+        config.type() == ProjectType::Fuzz ||
+        config.name() == L"utilities")
+      continue;
+
+    projects.push_back(Project::create(config,options));
+  }
+
+  createCoderProjects(options,configs,projects);
+  createDemoProjects(options,configs,projects);
+  createFilterProjects(options,configs,projects);
+  createFuzzProjects(options,configs,projects);
+  createUtilitiesProjects(options,configs,projects);
+}
+
 void Projects::createUtilitiesProjects(const Options &options,vector<Config> &configs,vector<Project> &projects)
 {
   const auto utilitiesConfig=find_if(configs.begin(),configs.end(),[&](const auto &config) { return (config.name() == L"utilities"); });
@@ -129,14 +270,14 @@ void Projects::createUtilitiesProjects(const Options &options,vector<Config> &co
 
   const auto utilitiesProject=Project::create(*utilitiesConfig,options);
 
-  const auto aliases = { L"compare", L"composite", L"conjure", L"identify", L"mogrify", L"montage", L"stream" };
+  const vector<wstring> aliases = { L"compare", L"composite", L"conjure", L"identify", L"mogrify", L"montage", L"stream" };
 
 
   for (const auto& alias : aliases)
   {
     if (options.isImageMagick7)
     {
-      if (!options.onlyMagick)
+      if (!options.onlyMagick && !options.magickAliases)
         createUtilityProject(utilitiesProject,alias,L"magick",projects);
     }
     else
@@ -144,7 +285,13 @@ void Projects::createUtilitiesProjects(const Options &options,vector<Config> &co
   }
 
   if (options.isImageMagick7)
+  {
     createUtilityProject(utilitiesProject,L"magick",L"magick",projects);
+
+    // The aliases are copies of magick.exe that dispatch on their name, they don't need to be linked again.
+    if (options.magickAliases)
+      projects.back().setAliases(aliases);
+  }
   else
     createUtilityProject(utilitiesProject,L"convert",L"convert",projects);
 }
@@ -158,6 +305,100 @@ void Projects::createUtilityProject(const Project &utilitiesProject,wstring name
   projects.push_back(utilityProject);
 }
 
+void Projects::createVariantProjects(const Options &options,vector<Config> &configs,vector<Project> &projects)
+{
+  vector<Config>
+    dependencyConfigs,
+    variantConfigs;
+
+  set<wstring>
+    variantLibraries;
+
+  // Only the projects that include magick-baseconfig.h differ between the variants, the dependencies are built once.
+  for (const auto& config : configs)
+  {
+    if (startsWith(config.directory(),L"ImageMagick\\") && config.isLibrary())
+      variantLibraries.insert(config.name());
+  }
+
+  for (const auto& config : configs)
+  {
+    auto isVariant=startsWith(config.directory(),L"ImageMagick\\");
+    for (const auto& reference : config.references())
+    {
+      if (variantLibraries.find(reference) != variantLibraries.end())
+        isVariant=true;
+    }
+
+    if (isVariant)
+      variantConfigs.push_back(config);
+    else
+      dependencyConfigs.push_back(config);
+  }
+
+  createProjects(options,dependencyConfigs,projects);
+
+  for (const auto& variant : options.variants)
+    createProjects(options.variantOptions(variant),variantConfigs,projects);
+}
+
+void Projects::prune(const Options &options,vector<Project> &projects)
+{
+  if (options.targets.empty())
+    return;
+
+  const ProjectGraph graph(projects);
+
+  vector<size_t> roots;
+  for (const auto& target : options.targets)
+  {
+    const auto indices=graph.find(target);
+    if (indices.empty())
+      throwException(L"Unknown target: " + target);
+
+    roots.insert(roots.end(),indices.begin(),indices.end());
+  }
+
+  const auto reachable=graph.closure(roots);
+
+  vector<Project> remainingProjects;
+  vector<wstring> prunedProjects;
+  for (size_t i=0; i < projects.size(); i++)
+  {
+    if (reachable[i])
+      remainingProjects.push_back(projects[i]);
+    else
+      prunedProjects.push_back(projects[i].fullName());
+  }
+
+  projects.swap(remainingProjects);
+  writePrunedProjects(options,prunedProjects);
+}
+
+void Projects::removeUnreferencedDependencies(vector<Project> &projects)
+{
+  const ProjectGraph graph(projects);
+
+  vector<size_t> roots;
+  for (size_t i=0; i < projects.size(); i++)
+  {
+    // A dependency library is only kept when it is still referenced.
+    if (!projects[i].isLibrary() || projects[i].isMagickProject() || startsWith(projects[i].directory(),L"ImageMagick\\"))
+      roots.push_back(i);
+  }
+
+  const auto reachable=graph.closure(roots);
+
+  vector<Project> remainingProjects;
+  for (size_t i=0; i < projects.size(); i++)
+  {
+    if (reachable[i])
+      remainingProjects.push_back(projects[i]);
+  }
+
+  projects.swap(remainingProjects);
+}
+
 void Projects::write(const vector<Project> &projects)
 {
   for (const auto& project : projects)
@@ -168,3 +409,16 @@ void Projects::write(const vector<Project> &projects)
     project.writeMagickBaseconfigDefine();
   }
 }
+
+void Projects::writePrunedProjects(const Options &options,const vector<wstring> &names)
+{
+  const auto reportFileName=options.rootDirectory + L"Artifacts\\pruned-projects.txt";
+  filesystem::create_directories(filesystem::path(reportFileName).parent_path());
+
+  wofstream file(reportFileName);
+  if (!file)
+    throwException(L"Failed to open file: " + reportFileName);
+
+  for (const auto& name : names)
+    file << name << endl;
+}
@@ -29,9 +29,13 @@ class Projects
 public:
   static vector<Project> create(const Options &options,vector<Config> &configs);
 
+  static void prune(const Options &options,vector<Project> &projects);
+
   static void write(const vector<Project> &projects);
 
 private:
+  static set<wstring> coreCoderNames(const Options &options,const vector<Project> &coderProjects);
+
   static void createCoderProjects(const Options &options,vector<Config> &configs,vector<Project> &projects);
 
   static void createDemoProjects(const Options &options,vector<Config> &configs,vector<Project> &projects);
@@ -40,7 +44,17 @@ private:
 
   static void createFuzzProjects(const Options &options,vector<Config> &configs,vector<Project> &projects);
 
+  static void createProjects(const Options &options,vector<Config> &configs,vector<Project> &projects);
+
   static void createUtilitiesProjects(const Options &options,vector<Config> &configs,vector<Project> &projects);
 
   static void createUtilityProject(const Project &utilitiesProject,wstring name,wstring fileName,vector<Project> &projects);
+
+  static void createVariantProjects(const Options &options,vector<Config> &configs,vector<Project> &projects);
+
+  static set<wstring> formatCoderNames(const Options &options,const vector<Config> &configs,const Project &codersProject);
+
+  static void removeUnreferencedDependencies(vector<Project> &projects);
+
+  static void writePrunedProjects(const Options &options,const vector<wstring> &names);
 };
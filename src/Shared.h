@@ -21,16 +21,20 @@
 
 using namespace std;
 
-enum class Architecture {x86, x64, Arm64};
+enum class Architecture {x86, x64, Arm64, Arm64EC};
 
 enum class Compiler {Default, CPP};
 
+enum class InstructionSet {Baseline, x64v2, x64v3, x64v4};
+
 enum class PolicyConfig {Limited, Open, Secure, WebSafe};
 
 enum class ProjectType {Undefined, Application, Coder, Demo, Filter, Fuzz, DynamicLibrary, StaticLibrary};
 
 enum class QuantumDepth {Q8, Q16, Q32, Q64};
 
+enum class Toolset {MSVC, ClangCL};
+
 enum class VisualStudioVersion {VS2017, VS2019, VS2022};
 
 #define VSLATEST VisualStudioVersion::VS2022
@@ -56,6 +60,26 @@ static inline bool startsWith(const wstring &s,const wstring &start)
   return(index == 0);
 }
 
+static inline wstring toLower(const wstring &input)
+{
+  wstring
+    result;
+
+  result=input;
+  transform(result.begin(),result.end(),result.begin(),[](wchar_t c) { return(towlower(c)); });
+  return(result);
+}
+
+static inline wstring toUpper(const wstring &input)
+{
+  wstring
+    result;
+
+  result=input;
+  transform(result.begin(),result.end(),result.begin(),[](wchar_t c) { return(towupper(c)); });
+  return(result);
+}
+
 static inline wstring trim(const wstring &input)
 {
   wstring
@@ -67,6 +91,66 @@ static inline wstring trim(const wstring &input)
   return(result);
 }
 
+static inline vector<wstring> split(const wstring &input,const wchar_t separator)
+{
+  vector<wstring>
+    result;
+
+  wstring
+    value;
+
+  wstringstream
+    stream(input);
+
+  while (getline(stream,value,separator))
+  {
+    value=trim(value);
+    if (!value.empty())
+      result.push_back(value);
+  }
+
+  return(result);
+}
+
+static inline bool matchesGlob(const wstring &input,const wstring &pattern)
+{
+  size_t
+    backtrackInput,
+    backtrackPattern,
+    i,
+    p;
+
+  i=0;
+  p=0;
+  backtrackInput=wstring::npos;
+  backtrackPattern=wstring::npos;
+  while (i < input.length())
+  {
+    if (p < pattern.length() && pattern[p] == L'*')
+    {
+      backtrackPattern=++p;
+      backtrackInput=i;
+    }
+    else if (p < pattern.length() && (pattern[p] == L'?' || towlower(pattern[p]) == towlower(input[i])))
+    {
+      p++;
+      i++;
+    }
+    else if (backtrackPattern != wstring::npos)
+    {
+      p=backtrackPattern;
+      i=++backtrackInput;
+    }
+    else
+      return(false);
+  }
+
+  while (p < pattern.length() && pattern[p] == L'*')
+    p++;
+
+  return(p == pattern.length());
+}
+
 static inline string wstringToString(const wstring &ws)
 { 
   string
@@ -112,6 +196,30 @@ static inline void throwException(const wstring& message)
   throw runtime_error(wstringToString(message));
 }
 
+static inline void writeFileIfChanged(const wstring &fileName,const wstring &content)
+{
+  wifstream
+    existingFile(filesystem::path(fileName).c_str());
+
+  if (existingFile)
+  {
+    wstringstream
+      existingContent;
+
+    existingContent << existingFile.rdbuf();
+    if (existingContent.str() == content)
+      return;
+
+    existingFile.close();
+  }
+
+  wofstream file(filesystem::path(fileName).c_str());
+  if (!file)
+    throwException(L"Unable to open: " + fileName);
+
+  file << content;
+}
+
 static inline wstring replace(const wstring &str,const wstring &from,const wstring &to)
 {
   size_t
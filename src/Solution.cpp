@@ -18,6 +18,7 @@
 %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
 */
 #include "Solution.h"
+#include "ProjectGraph.h"
 
 const wstring Solution::solutionDirectory(const Project &project)
 {
@@ -32,6 +33,15 @@ const wstring Solution::solutionDirectory(const Project &project)
   }
 }
 
+const wstring Solution::solutionFilterName(const Project &project)
+{
+  if (!startsWith(project.directory(),L"Dependencies\\") && !startsWith(project.directory(),L"OptionalDependencies\\"))
+    return(solutionDirectory(project));
+
+  // Every dependencies folder gets its own filter, the project directory ends with a backslash.
+  return(filesystem::path(project.directory()).parent_path().parent_path().filename().wstring());
+}
+
 const wstring Solution::solutionName(const Options &options)
 {
   wstring
@@ -39,7 +49,7 @@ const wstring Solution::solutionName(const Options &options)
 
   name+=(options.isImageMagick7 ? L"7." : L"6.");
   name+=(options.isStaticBuild ? L"Static." : L"Dynamic.");
-  name+=options.architectureName();
+  name+=options.instructionSetName();
   name+=L".sln";
 
   return(name);
@@ -59,17 +69,19 @@ void Solution::write(const Options &options,const vector<Project> &projects)
   writeProjectDirectories(file,projects);
   file << L"Global" << endl;
   file << L"\tGlobalSection(SolutionConfigurationPlatforms) = preSolution" << endl;
-  file << L"\t\tDebug|" << options.architectureName() << " = Debug|" << options.architectureName() << endl;
-  file << L"\t\tRelease|" << options.architectureName() << " = Release|" << options.architectureName() << endl;
+  for (const auto& configuration : options.configurations())
+    file << L"\t\t" << configuration << "|" << options.architectureName() << " = " << configuration << "|" << options.architectureName() << endl;
   file << L"\tEndGlobalSection" << endl;
   writeProjectsConfiguration(file,options,projects);
   writeProjectsNesting(file,projects);
   file << L"EndGlobal" << endl;
+
+  writeSolutionFilters(options,projects);
 }
 
 void Solution::writeConfigDirectory(wofstream &file,const Options& options)
 {
-  const auto binDirectory=options.rootDirectory + L"Artifacts\\bin";
+  const auto binDirectory=options.rootDirectory + options.artifactsDirectory(L"bin");
   if (!filesystem::exists(binDirectory))
     return;
 
@@ -84,7 +96,7 @@ void Solution::writeConfigDirectory(wofstream &file,const Options& options)
     if (!endsWith(fileName, L".xml"))
       continue;
 
-    file << "\t\tArtifacts\\bin\\" << fileName << " = Artifacts\\bin\\" << fileName << endl;
+    file << "\t\t" << options.artifactsDirectory(L"bin") << "\\" << fileName << " = " << options.artifactsDirectory(L"bin") << "\\" << fileName << endl;
   }
   file << "\tEndProjectSection" << endl;
   file << "EndProject" << endl;
@@ -117,10 +129,11 @@ void Solution::writeProjectsConfiguration(wofstream& file,const Options& options
   file << "\tGlobalSection(ProjectConfigurationPlatforms) = postSolution" << endl;
   for (const auto& project : projects)
   {
-    file << "\t\t{" << project.guid() << L"}.Debug|" << options.architectureName() << L".ActiveCfg = Debug|" << options.platform() << endl;
-    file << "\t\t{" << project.guid() << L"}.Debug|" << options.architectureName() << L".Build.0 = Debug|" << options.platform() << endl;
-    file << "\t\t{" << project.guid() << L"}.Release|" << options.architectureName() << L".ActiveCfg = Release|" << options.platform() << endl;
-    file << "\t\t{" << project.guid() << L"}.Release|" << options.architectureName() << L".Build.0 = Release|" << options.platform() << endl;
+    for (const auto& configuration : options.configurations())
+    {
+      file << "\t\t{" << project.guid() << L"}." << configuration << "|" << options.architectureName() << L".ActiveCfg = " << configuration << "|" << options.platform() << endl;
+      file << "\t\t{" << project.guid() << L"}." << configuration << "|" << options.architectureName() << L".Build.0 = " << configuration << "|" << options.platform() << endl;
+    }
   }
   file << "\tEndGlobalSection" << endl;
 }
@@ -135,6 +148,53 @@ void Solution::writeProjectsNesting(wofstream& file,const vector<Project>& proje
   file << L"\tEndGlobalSection" << endl;
 }
 
+void Solution::writeSolutionFilter(const Options &options,const vector<Project> &projects,const wstring &name,const vector<size_t> &roots)
+{
+  const auto solutionFileName=solutionName(options);
+  const auto filterFileName=options.rootDirectory + solutionFileName.substr(0,solutionFileName.length() - 4) + L"." + name + L".slnf";
+  wofstream file(filterFileName);
+  if (!file)
+    throwException(L"Failed to open file: " + filterFileName);
+
+  const ProjectGraph graph(projects);
+  const auto reachable=graph.closure(roots);
+
+  file << "{" << endl;
+  file << "  \"solution\": {" << endl;
+  file << "    \"path\": \"" << solutionFileName << "\"," << endl;
+  file << "    \"projects\": [" << endl;
+  bool first=true;
+  for (size_t i=0; i < projects.size(); i++)
+  {
+    if (!reachable[i])
+      continue;
+
+    if (!first)
+      file << "," << endl;
+    file << "      \"" << replace(projects[i].fileName(),L"\\",L"\\\\") << "\"";
+    first=false;
+  }
+  file << endl;
+  file << "    ]" << endl;
+  file << "  }" << endl;
+  file << "}" << endl;
+}
+
+void Solution::writeSolutionFilters(const Options &options,const vector<Project> &projects)
+{
+  map<wstring,vector<size_t>> solutionDirectories;
+  for (size_t i=0; i < projects.size(); i++)
+  {
+    solutionDirectories[solutionFilterName(projects[i])].push_back(i);
+
+    if (projects[i].isMagickProject() && projects[i].isLibrary())
+      writeSolutionFilter(options,projects,projects[i].fullName(),{ i });
+  }
+
+  for (const auto& solutionDirectory : solutionDirectories)
+    writeSolutionFilter(options,projects,solutionDirectory.first,solutionDirectory.second);
+}
+
 void Solution::writeVisualStudioVersion(wofstream& file,const Options &options)
 {
   switch(options.visualStudioVersion)
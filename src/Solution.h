@@ -26,12 +26,14 @@
 class Solution
 {
 public:
+  static const wstring solutionName(const Options &options);
+
   static void write(const Options &options,const vector<Project> &projects);
 
 private:
   static const wstring solutionDirectory(const Project & project);
 
-  static const wstring solutionName(const Options &options);
+  static const wstring solutionFilterName(const Project &project);
 
   static void writeConfigDirectory(wofstream& file,const Options& options);
 
@@ -43,5 +45,9 @@ private:
 
   static void writeProjectsNesting(wofstream& file,const vector<Project>& projects);
 
+  static void writeSolutionFilter(const Options &options,const vector<Project> &projects,const wstring &name,const vector<size_t> &roots);
+
+  static void writeSolutionFilters(const Options &options,const vector<Project> &projects);
+
   static void writeVisualStudioVersion(wofstream& file,const Options &options);
 };
@@ -0,0 +1,32 @@
+#include "../BuildLog.h"
+
+static int failures=0;
+
+static void check(bool condition,const char *message)
+{
+  if (condition)
+    return;
+
+  cerr << "FAILED: " << message << endl;
+  failures++;
+}
+
+static bool equals(double value,double expected)
+{
+  return(value > expected - 0.001 && value < expected + 0.001);
+}
+
+int main(int argc,char **argv)
+{
+  const auto log=BuildLog::load(argc > 1 ? wstring(argv[1],argv[1] + strlen(argv[1])) : L"Fixtures/build-timings.log");
+
+  check(log.projectDurations().size() == 2,"the target summary is not read as projects");
+  check(equals(log.projectDurations().at(L"core_zlib"),2500.0),"duration of CORE_zlib");
+  check(equals(log.projectDurations().at(L"core_magickcore"),60000.0),"duration of CORE_MagickCore");
+
+  check(log.fileDurations().size() == 2,"one duration per source file");
+  check(equals(log.fileDurations().at(L"c:\\imagemagick\\magickcore\\resize.c"),1750.0),"compiler passes are added up");
+  check(equals(log.fileDurations().at(L"c:\\imagemagick\\dependencies\\zlib\\deflate.c"),125.0),"duration of deflate.c");
+
+  return(failures == 0 ? 0 : 1);
+}
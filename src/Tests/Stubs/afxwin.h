@@ -0,0 +1,14 @@
+#pragma once
+// Minimal stand-in for MFC so the parsers can be checked without Windows.
+#include <algorithm>
+#include <cstring>
+#include <cwctype>
+#include <iomanip>
+#include <stdexcept>
+
+typedef int BOOL;
+#define TRUE 1
+#define FALSE 0
+
+static inline bool IsDebuggerPresent() { return(false); }
+static inline void DebugBreak() {}
@@ -24,13 +24,11 @@ void ThresholdMap::write(const Options &options)
   if (!options.zeroConfigurationSupport)
     return;
 
-  wifstream thresholds(options.rootDirectory + L"Artifacts\\bin\\thresholds.xml");
+  wifstream thresholds(options.rootDirectory + options.artifactsDirectory(L"bin") + L"\\thresholds.xml");
   if (!thresholds)
     throwException(L"Unable to open thresholds.xml");
 
-  wofstream thresholdMap(options.rootDirectory + L"ImageMagick\\" + options.magickCoreName() + L"\\threshold-map.h");
-  if (!thresholdMap)
-    throwException(L"Unable to open threshold-map.h");
+  wstringstream thresholdMap;
 
   thresholdMap << "static const char *const BuiltinMap=" << endl;
 
@@ -45,4 +43,6 @@ void ThresholdMap::write(const Options &options)
   }
 
   thresholdMap << ";";
+
+  writeFileIfChanged(options.rootDirectory + L"ImageMagick\\" + options.magickCoreName() + L"\\threshold-map.h",thresholdMap.str());
 }
@@ -304,11 +304,22 @@ void VersionInfo::write() const
 {
   const auto versionFile=L"ImageMagick\\" + _options.magickCoreName() + L"\\version.h";
 
-  write(L"ImageMagick\\" + _options.magickCoreName() + L"\\version.h.in",versionFile);
-  write(L"ImageMagick\\config\\configure.xml.in",L"Artifacts\\bin\\configure.xml");
+  // A variant only has its own version.h and configure.xml, they depend on the quantum depth.
+  if (!_options.variant.empty())
+  {
+    const auto variantDirectory=_options.variantDirectory() + L"\\" + _options.magickCoreName();
+    filesystem::create_directories(_options.rootDirectory + variantDirectory);
+
+    write(versionFile + L".in",variantDirectory + L"\\version.h");
+    write(L"ImageMagick\\config\\configure.xml.in",_options.artifactsDirectory(L"bin") + L"\\configure.xml");
+    return;
+  }
+
+  write(versionFile + L".in",versionFile);
+  write(L"ImageMagick\\config\\configure.xml.in",_options.artifactsDirectory(L"bin") + L"\\configure.xml");
 
   write(L"Configure\\Configs\\package.version.h.in",L"Configure\\Configs\\package.version.h");
-  filesystem::copy(_options.rootDirectory + versionFile,_options.rootDirectory + L"Configure\\Configs\\version.h",filesystem::copy_options::overwrite_existing);
+  write(versionFile + L".in",L"Configure\\Configs\\version.h");
 }
 
 void VersionInfo::write(wstring inputFile,wstring outputFile) const
@@ -317,9 +328,7 @@ void VersionInfo::write(wstring inputFile,wstring outputFile) const
   if (!input)
     throwException(L"Unable to open: " + inputFile);
 
-  wofstream output(_options.rootDirectory + outputFile);
-  if (!output)
-    throwException(L"Unable to open: " + outputFile);
+  wstringstream output;
 
   wstring line;
   while (getline(input,line))
@@ -334,4 +343,7 @@ void VersionInfo::write(wstring inputFile,wstring outputFile) const
 
     output << line << endl;
   }
+
+  // Only touch the file when it changes so a reconfigure does not cause a rebuild.
+  writeFileIfChanged(_options.rootDirectory + outputFile,output.str());
 }
@@ -34,7 +34,7 @@ const wstring XmlConfigFiles::getPolicyFileName(const Options &options)
 void XmlConfigFiles::write(const Options &options)
 {
   const auto configDirectory=options.rootDirectory + L"ImageMagick\\config\\";
-  const auto targetDirectory=options.rootDirectory + L"Artifacts\\bin\\";
+  const auto targetDirectory=options.rootDirectory + options.artifactsDirectory(L"bin") + L"\\";
 
   filesystem::copy_file(configDirectory + getPolicyFileName(options),targetDirectory + L"policy.xml",filesystem::copy_options::overwrite_existing);
 
@@ -32,8 +32,10 @@
 
 #include "resource.h" // main symbols
 
+#include <execution>
 #include <filesystem>
 #include <fstream>
+#include <functional>
 #include <iostream>
 #include <map>
 #include <numeric>